@@ -0,0 +1,470 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
+#define OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
+
+#include "lib/hash_func/ob_hash_func.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/utility/utility.h"
+#include "lib/hash/ob_hashutils.h"
+
+namespace oceanbase
+{
+namespace common
+{
+namespace hash
+{
+/**
+ * Copy-on-write hash map only for pointer, with the same interface of ObPointerHashMap.
+ *
+ * The map is a hash trie indexed by the hash value of the key, 4 bits per level. assign()
+ * shares all nodes with the other map, and a later write of either map copies only the
+ * nodes on the path to the written entry. So a new version of a big map costs
+ * O(changed entries) instead of O(all entries).
+ *
+ * Nodes are reference counted. Maps sharing nodes can be read and destroyed by different
+ * threads, but a map must not be read while it is written.
+ */
+template <class K, class V, template <class, class> class GetKey,
+          class Allocator = ModulePageAllocator>
+class ObCowPointerHashMap
+{
+  static const int64_t LEVEL_BITS = 4;
+  static const int64_t FANOUT = 1 << LEVEL_BITS;
+  static const int64_t MAX_DEPTH = 64 / LEVEL_BITS;
+  // a leaf above the max depth is split to an inner node if it exceeds this count
+  static const int64_t MAX_LEAF_COUNT = 8;
+
+  struct Node
+  {
+    explicit Node(const bool is_leaf) : ref_cnt_(1), is_leaf_(is_leaf), count_(0) {}
+    int64_t ref_cnt_;
+    bool is_leaf_;
+    // leaf: entry count, inner: not null child count
+    int64_t count_;
+  };
+
+  struct InnerNode : public Node
+  {
+    InnerNode() : Node(false) { memset(children_, 0, sizeof(children_)); }
+    Node *children_[FANOUT];
+  };
+
+  struct Entry
+  {
+    uint64_t hash_;
+    V value_;
+  };
+
+  struct LeafNode : public Node
+  {
+    explicit LeafNode(const int64_t capacity) : Node(true), capacity_(capacity) {}
+    int64_t capacity_;
+    // This must be the last field of this class
+    Entry entries_[0];
+  };
+
+public:
+  explicit ObCowPointerHashMap(const lib::ObLabel &label = ObModIds::OB_HASH_NODE)
+      : root_(NULL), item_count_(0), allocator_(label)
+  {
+  }
+
+  explicit ObCowPointerHashMap(const Allocator &alloc)
+      : root_(NULL), item_count_(0), allocator_(alloc)
+  {
+  }
+
+  ~ObCowPointerHashMap()
+  {
+    destroy();
+  }
+
+  // share all nodes with %other
+  int assign(const ObCowPointerHashMap &other)
+  {
+    if (this != &other) {
+      destroy();
+      allocator_ = other.allocator_;
+      root_ = other.root_;
+      item_count_ = other.item_count_;
+      if (NULL != root_) {
+        ATOMIC_AAF(&root_->ref_cnt_, 1);
+      }
+    }
+    return OB_SUCCESS;
+  }
+
+  ObCowPointerHashMap &operator =(const ObCowPointerHashMap &other)
+  {
+    (void)assign(other);
+    return *this;
+  }
+
+  explicit ObCowPointerHashMap(const ObCowPointerHashMap &other)
+      : root_(NULL), item_count_(0)
+  {
+    *this = other;
+  }
+
+  void destroy()
+  {
+    release(root_);
+    root_ = NULL;
+    item_count_ = 0;
+  }
+
+  int init() { return OB_SUCCESS; }
+
+  /**
+   * put a key value pair into HashMap
+   * when overwrite = 0, do not overwrite existing <key,value> pair
+   * when overwrite != 0, overwrite existing <key,value> pair
+   * @retval OB_SUCCESS  success
+   * @retval OB_HASH_EXIST key exist when overwrite = 0
+   * @retval other errors
+   */
+  int set_refactored(const K &key, const V &value, V &over_write_value, int overwrite = 0,
+                     int overwrite_key = 0)
+  {
+    int ret = OB_SUCCESS;
+    const uint64_t hash_val = do_hash(key);
+    const Entry *entry = find(key, hash_val);
+    UNUSED(overwrite_key);
+    over_write_value = (V(0));
+    if (NULL != entry && 0 == overwrite) {
+      ret = OB_HASH_EXIST;
+    } else if (NULL != entry) {
+      Entry *mutable_entry = NULL;
+      if (OB_FAIL(write_path(key, hash_val, mutable_entry))) {
+        COMMON_LOG(WARN, "copy path failed", K(ret));
+      } else {
+        over_write_value = mutable_entry->value_;
+        mutable_entry->value_ = value;
+      }
+    } else if (OB_FAIL(insert(root_, hash_val, value, 0))) {
+      COMMON_LOG(WARN, "insert failed", K(ret));
+    } else {
+      item_count_++;
+    }
+    return ret;
+  }
+
+  int set_refactored(const K &key, const V &value, int overwrite = 0, int overwrite_key = 0)
+  {
+    V over_write_value = (V(0));
+    return set_refactored(key, value, over_write_value, overwrite, overwrite_key);
+  }
+
+  /**
+   * @retval OB_SUCCESS get the corresponding value of key
+   * @retval OB_HASH_NOT_EXIST key does not exist
+   */
+  int get_refactored(const K &key, V &value) const
+  {
+    int ret = OB_SUCCESS;
+    const Entry *entry = find(key, do_hash(key));
+    if (NULL == entry) {
+      ret = OB_HASH_NOT_EXIST;
+    } else {
+      value = entry->value_;
+    }
+    return ret;
+  }
+
+  const V *get(const K &key) const
+  {
+    const Entry *entry = find(key, do_hash(key));
+    return NULL == entry ? NULL : &entry->value_;
+  }
+
+  // @retval OB_SUCCESS success
+  // @retval OB_HASH_NOT_EXIST key not found
+  // @retval other errors
+  int erase_refactored(const K &key, V &erased_value)
+  {
+    int ret = OB_SUCCESS;
+    const uint64_t hash_val = do_hash(key);
+    if (NULL == find(key, hash_val)) {
+      ret = OB_HASH_NOT_EXIST;
+    } else if (OB_FAIL(erase(root_, key, hash_val, 0, erased_value))) {
+      COMMON_LOG(WARN, "erase failed", K(ret));
+    } else {
+      item_count_--;
+    }
+    return ret;
+  }
+
+  int erase_refactored(const K &key)
+  {
+    V erased_value = (V(0));
+    return erase_refactored(key, erased_value);
+  }
+
+  void clear() { destroy(); }
+
+  int64_t count() const { return item_count_; }
+  int64_t item_count() const { return item_count_; }
+
+private:
+  static int64_t get_child_idx(const uint64_t hash_val, const int64_t depth)
+  {
+    return static_cast<int64_t>((hash_val >> (depth * LEVEL_BITS)) & (FANOUT - 1));
+  }
+
+  static bool is_exclusive(const Node *node)
+  {
+    return 1 == ATOMIC_LOAD(&node->ref_cnt_);
+  }
+
+  const Entry *find(const K &key, const uint64_t hash_val) const
+  {
+    const Entry *entry = NULL;
+    const Node *node = root_;
+    for (int64_t depth = 0; NULL != node && !node->is_leaf_; depth++) {
+      node = static_cast<const InnerNode *>(node)->children_[get_child_idx(hash_val, depth)];
+    }
+    if (NULL != node) {
+      const LeafNode *leaf = static_cast<const LeafNode *>(node);
+      for (int64_t i = 0; NULL == entry && i < leaf->count_; i++) {
+        if (leaf->entries_[i].hash_ == hash_val && get_key_(leaf->entries_[i].value_) == key) {
+          entry = &leaf->entries_[i];
+        }
+      }
+    }
+    return entry;
+  }
+
+  LeafNode *alloc_leaf(const int64_t capacity)
+  {
+    LeafNode *leaf = NULL;
+    void *buf = allocator_.alloc(sizeof(LeafNode) + capacity * sizeof(Entry));
+    if (NULL != buf) {
+      leaf = new (buf) LeafNode(capacity);
+    }
+    return leaf;
+  }
+
+  InnerNode *alloc_inner()
+  {
+    InnerNode *inner = NULL;
+    void *buf = allocator_.alloc(sizeof(InnerNode));
+    if (NULL != buf) {
+      inner = new (buf) InnerNode();
+    }
+    return inner;
+  }
+
+  void release(Node *node)
+  {
+    if (NULL != node && 0 == ATOMIC_SAF(&node->ref_cnt_, 1)) {
+      if (!node->is_leaf_) {
+        InnerNode *inner = static_cast<InnerNode *>(node);
+        for (int64_t i = 0; i < FANOUT; i++) {
+          release(inner->children_[i]);
+        }
+      }
+      allocator_.free(node);
+    }
+  }
+
+  // make %node exclusively owned by the map before writing it, %node is replaced by its
+  // copy if it is shared with other maps.
+  int make_exclusive(Node *&node)
+  {
+    int ret = OB_SUCCESS;
+    if (!is_exclusive(node)) {
+      Node *copy = NULL;
+      if (node->is_leaf_) {
+        const LeafNode *leaf = static_cast<const LeafNode *>(node);
+        LeafNode *new_leaf = alloc_leaf(leaf->capacity_);
+        if (NULL != new_leaf) {
+          MEMCPY(new_leaf->entries_, leaf->entries_, leaf->count_ * sizeof(Entry));
+          new_leaf->count_ = leaf->count_;
+          copy = new_leaf;
+        }
+      } else {
+        const InnerNode *inner = static_cast<const InnerNode *>(node);
+        InnerNode *new_inner = alloc_inner();
+        if (NULL != new_inner) {
+          for (int64_t i = 0; i < FANOUT; i++) {
+            if (NULL != (new_inner->children_[i] = inner->children_[i])) {
+              ATOMIC_AAF(&new_inner->children_[i]->ref_cnt_, 1);
+            }
+          }
+          new_inner->count_ = inner->count_;
+          copy = new_inner;
+        }
+      }
+      if (NULL == copy) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        COMMON_LOG(WARN, "allocate node failed", K(ret));
+      } else {
+        release(node);
+        node = copy;
+      }
+    }
+    return ret;
+  }
+
+  // copy the shared nodes on the path to the existing entry of %key
+  int write_path(const K &key, const uint64_t hash_val, Entry *&entry)
+  {
+    int ret = OB_SUCCESS;
+    Node **slot = &root_;
+    entry = NULL;
+    for (int64_t depth = 0; OB_SUCC(ret) && NULL != *slot && NULL == entry; depth++) {
+      if (OB_FAIL(make_exclusive(*slot))) {
+        COMMON_LOG(WARN, "make node exclusive failed", K(ret));
+      } else if (!(*slot)->is_leaf_) {
+        slot = &static_cast<InnerNode *>(*slot)->children_[get_child_idx(hash_val, depth)];
+      } else {
+        LeafNode *leaf = static_cast<LeafNode *>(*slot);
+        for (int64_t i = 0; NULL == entry && i < leaf->count_; i++) {
+          if (leaf->entries_[i].hash_ == hash_val && get_key_(leaf->entries_[i].value_) == key) {
+            entry = &leaf->entries_[i];
+          }
+        }
+        if (NULL == entry) {
+          break;
+        }
+      }
+    }
+    if (OB_SUCC(ret) && NULL == entry) {
+      ret = OB_HASH_NOT_EXIST;
+    }
+    return ret;
+  }
+
+  // insert a value whose key does not exist into the subtree of %node
+  int insert(Node *&node, const uint64_t hash_val, const V &value, const int64_t depth)
+  {
+    int ret = OB_SUCCESS;
+    if (NULL == node) {
+      LeafNode *leaf = alloc_leaf(1);
+      if (NULL == leaf) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        COMMON_LOG(WARN, "allocate leaf failed", K(ret));
+      } else {
+        leaf->entries_[0].hash_ = hash_val;
+        leaf->entries_[0].value_ = value;
+        leaf->count_ = 1;
+        node = leaf;
+      }
+    } else if (OB_FAIL(make_exclusive(node))) {
+      COMMON_LOG(WARN, "make node exclusive failed", K(ret));
+    } else if (!node->is_leaf_) {
+      InnerNode *inner = static_cast<InnerNode *>(node);
+      Node *&child = inner->children_[get_child_idx(hash_val, depth)];
+      const bool is_new_child = NULL == child;
+      if (OB_FAIL(insert(child, hash_val, value, depth + 1))) {
+        COMMON_LOG(WARN, "insert failed", K(ret));
+      } else if (is_new_child) {
+        inner->count_++;
+      }
+    } else {
+      LeafNode *leaf = static_cast<LeafNode *>(node);
+      if (leaf->count_ < leaf->capacity_) {
+        leaf->entries_[leaf->count_].hash_ = hash_val;
+        leaf->entries_[leaf->count_].value_ = value;
+        leaf->count_++;
+      } else if (leaf->count_ < MAX_LEAF_COUNT || depth >= MAX_DEPTH) {
+        LeafNode *new_leaf = alloc_leaf(leaf->capacity_ * 2);
+        if (NULL == new_leaf) {
+          ret = OB_ALLOCATE_MEMORY_FAILED;
+          COMMON_LOG(WARN, "allocate leaf failed", K(ret));
+        } else {
+          MEMCPY(new_leaf->entries_, leaf->entries_, leaf->count_ * sizeof(Entry));
+          new_leaf->entries_[leaf->count_].hash_ = hash_val;
+          new_leaf->entries_[leaf->count_].value_ = value;
+          new_leaf->count_ = leaf->count_ + 1;
+          release(node);
+          node = new_leaf;
+        }
+      } else {
+        // split the full leaf into an inner node
+        InnerNode *inner = alloc_inner();
+        Node *inner_node = inner;
+        if (NULL == inner) {
+          ret = OB_ALLOCATE_MEMORY_FAILED;
+          COMMON_LOG(WARN, "allocate inner node failed", K(ret));
+        }
+        for (int64_t i = 0; OB_SUCC(ret) && i <= leaf->count_; i++) {
+          const uint64_t h = i < leaf->count_ ? leaf->entries_[i].hash_ : hash_val;
+          const V &v = i < leaf->count_ ? leaf->entries_[i].value_ : value;
+          if (OB_FAIL(insert(inner_node, h, v, depth))) {
+            COMMON_LOG(WARN, "insert failed", K(ret));
+          }
+        }
+        if (OB_SUCC(ret)) {
+          release(node);
+          node = inner_node;
+        } else {
+          release(inner_node);
+        }
+      }
+    }
+    return ret;
+  }
+
+  int erase(Node *&node, const K &key, const uint64_t hash_val, const int64_t depth,
+            V &erased_value)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_ISNULL(node)) {
+      ret = OB_HASH_NOT_EXIST;
+    } else if (OB_FAIL(make_exclusive(node))) {
+      COMMON_LOG(WARN, "make node exclusive failed", K(ret));
+    } else if (!node->is_leaf_) {
+      InnerNode *inner = static_cast<InnerNode *>(node);
+      Node *&child = inner->children_[get_child_idx(hash_val, depth)];
+      if (OB_FAIL(erase(child, key, hash_val, depth + 1, erased_value))) {
+        COMMON_LOG(WARN, "erase failed", K(ret));
+      } else if (NULL == child && 0 == --inner->count_) {
+        release(node);
+        node = NULL;
+      }
+    } else {
+      LeafNode *leaf = static_cast<LeafNode *>(node);
+      int64_t pos = -1;
+      for (int64_t i = 0; -1 == pos && i < leaf->count_; i++) {
+        if (leaf->entries_[i].hash_ == hash_val && get_key_(leaf->entries_[i].value_) == key) {
+          pos = i;
+        }
+      }
+      if (-1 == pos) {
+        ret = OB_HASH_NOT_EXIST;
+      } else {
+        erased_value = leaf->entries_[pos].value_;
+        leaf->entries_[pos] = leaf->entries_[leaf->count_ - 1];
+        if (0 == --leaf->count_) {
+          release(node);
+          node = NULL;
+        }
+      }
+    }
+    return ret;
+  }
+
+private:
+  Node *root_;
+  int64_t item_count_;
+  GetKey<K, V> get_key_;
+  Allocator allocator_;
+};
+} // namespace hash
+} // namespace common
+} // namespace oceanbase
+
+#endif // OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
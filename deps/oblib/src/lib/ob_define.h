@@ -1609,6 +1609,14 @@ const uint32_t NUM_DESC_2DIGITS_NEGATIVE_DECIMAL = 0x40000002;
 const uint32_t NUM_DESC_1DIGIT_NEGATIVE_FRAGMENT = 0x41000001;
 // len_ = 1, se_ = 64: 1 digit integer(e.g -111)
 const uint32_t NUM_DESC_1DIGIT_NEGATIVE_INTEGER = 0x40000001;
+// len_ = 3, se_ = 193: 3 digits(e.g: 1000000111.111)
+const uint32_t NUM_DESC_3DIGITS_POSITIVE_DECIMAL = 0xc1000003;
+// len_ = 2, se_ = 193: 2 digits integer(e.g: 1000000111)
+const uint32_t NUM_DESC_2DIGITS_POSITIVE_INTEGER = 0xc1000002;
+// len_ = 3, se_ = 63: 3 digits(e.g: -1000000111.111)
+const uint32_t NUM_DESC_3DIGITS_NEGATIVE_DECIMAL = 0x3f000003;
+// len_ = 2, se_ = 63: 2 digits integer(e.g: -1000000111)
+const uint32_t NUM_DESC_2DIGITS_NEGATIVE_INTEGER = 0x3f000002;
 
 
 const int64_t OB_DECIMAL_NOT_SPECIFIED = -1;
@@ -2235,6 +2243,22 @@ struct ObNumberDesc
   {
     return (desc_ == oceanbase::common::NUM_DESC_1DIGIT_NEGATIVE_INTEGER);
   }
+  bool is_3d_positive_decimal()
+  {
+    return (desc_ == oceanbase::common::NUM_DESC_3DIGITS_POSITIVE_DECIMAL);
+  }
+  bool is_2d_positive_integer()
+  {
+    return (desc_ == oceanbase::common::NUM_DESC_2DIGITS_POSITIVE_INTEGER);
+  }
+  bool is_3d_negative_decimal()
+  {
+    return (desc_ == oceanbase::common::NUM_DESC_3DIGITS_NEGATIVE_DECIMAL);
+  }
+  bool is_2d_negative_integer()
+  {
+    return (desc_ == oceanbase::common::NUM_DESC_2DIGITS_NEGATIVE_INTEGER);
+  }
 
   union
   {
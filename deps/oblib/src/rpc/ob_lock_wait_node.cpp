@@ -18,7 +18,7 @@ namespace rpc
 {
 
 ObLockWaitNode::ObLockWaitNode() :
-  hold_key_(0), need_wait_(false), addr_(NULL), recv_ts_(0), lock_ts_(0), lock_seq_(0),
+  hold_key_(0), origin_hash_(0), is_handoff_(false), need_wait_(false), addr_(NULL), recv_ts_(0), lock_ts_(0), lock_seq_(0),
   abs_timeout_(0), tablet_id_(common::OB_INVALID_ID), try_lock_times_(0), sessid_(0),
   block_sessid_(0), tx_id_(0), holder_tx_id_(0), run_ts_(0), is_standalone_task_(false),
   last_compact_cnt_(0), total_update_cnt_(0) {}
@@ -34,6 +34,7 @@ void ObLockWaitNode::set(void* addr,
                          int64_t tx_id,
                          int64_t holder_tx_id) {
   hash_ = hash | 1;
+  origin_hash_ = hash_;
   addr_ = addr;
   lock_ts_ = common::ObTimeUtil::current_time();
   lock_seq_ = lock_seq;
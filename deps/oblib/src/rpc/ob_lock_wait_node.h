@@ -46,7 +46,10 @@ struct ObLockWaitNode: public common::SpHashNode
   void set_standalone_task(const bool is_standalone_task) { is_standalone_task_ = is_standalone_task; }
   bool is_standalone_task() const { return is_standalone_task_; }
   bool need_wait() { return need_wait_; }
-  void on_retry_lock(uint64_t hash) { hold_key_ = hash; }
+  void on_retry_lock(uint64_t hash) { hold_key_ = hash; is_handoff_ = false; }
+  // the request is handed the row in handoff mode, the next waiter of the row
+  // is woken by the commit of this request's transaction once it locks the row
+  void on_handoff_lock(uint64_t hash) { hold_key_ = hash; is_handoff_ = true; }
   void set_session_info(uint32_t sessid) {
     int ret = common::OB_SUCCESS;
     if (0 == sessid) {
@@ -62,6 +65,7 @@ struct ObLockWaitNode: public common::SpHashNode
   TO_STRING_KV(KP(this),
                KP_(addr),
                K_(hash),
+               K_(origin_hash),
                K_(lock_ts),
                K_(lock_seq),
                K_(abs_timeout),
@@ -75,10 +79,16 @@ struct ObLockWaitNode: public common::SpHashNode
                K_(holder_tx_id),
                K_(need_wait),
                K_(is_standalone_task),
+               K_(is_handoff),
                K_(last_compact_cnt),
                K_(total_update_cnt));
 
   uint64_t hold_key_;
+  // the hash the request was first parked on, kept across change_hash so that
+  // waiters transferred from a row to its holder transaction can be handed
+  // back to the row queue one by one
+  uint64_t origin_hash_;
+  bool is_handoff_;
   ObLink retire_link_;
   bool need_wait_;
   void* addr_;
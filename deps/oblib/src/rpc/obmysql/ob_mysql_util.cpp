@@ -366,7 +366,6 @@ int ObMySQLUtil::int_cell_str(
       } else if (zero_cnt > 0 && OB_UNLIKELY(pos + bytes_to_store_len + zero_cnt + ffi.length() > len)) {
         ret = OB_SIZE_OVERFLOW;
       } else {
-        MEMCPY(buf + pos + bytes_to_store_len, ffi.ptr(), ffi.length());
         if (zero_cnt > 0) {
           /*zero_cnt > 0 indicates that zerofill is true */
           MEMSET(buf + pos + bytes_to_store_len, '0', zero_cnt);
@@ -22,6 +22,8 @@
 #include "lib/thread/ob_thread_name.h"
 #include "lib/utility/ob_macro_utils.h"
 #include "lib/profile/ob_trace_id.h"
+#include "lib/stat/ob_diagnose_info.h"
+#include "lib/worker.h"
 #include <sys/epoll.h>
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -331,6 +333,7 @@ private:
 class ObSqlSock: public ObLink
 {
 public:
+  static const int64_t WAIT_WRITABLE_INTERVAL_US = 1000 * 1000;
   ObSqlSock(ObSqlNioImpl *nio, int fd): nio_impl_(nio), fd_(fd), err_(0), read_buffer_(fd),
             need_epoll_trigger_write_(false), may_handling_(true), handler_close_flag_(false),
             need_shutdown_(false), last_decode_time_(0), last_write_time_(0), sql_session_info_(NULL) {
@@ -383,14 +386,31 @@ public:
   int write_data(const char* buf, int64_t sz) {
     int ret = OB_SUCCESS;
     int64_t pos = 0;
+    // a slow client is waited no longer than the timeout of the request, so that a client
+    // which stops reading does not hold the tenant worker forever. Only a deadline set by the
+    // current request bounds the wait: if it is not set, or it is older than the request or
+    // this write (left by a previous request), the wait is unbounded as before.
+    ObSqlSockSession* sess = (ObSqlSockSession *)sess_;
+    const int64_t start_ts = ObTimeUtility::current_time();
+    const int64_t recv_ts = sess->sql_req_.get_receive_timestamp();
+    const int64_t timeout_ts = (THIS_WORKER.is_timeout_ts_valid()
+                                && THIS_WORKER.get_timeout_ts() > MAX(recv_ts, start_ts))
+                               ? THIS_WORKER.get_timeout_ts() : INT64_MAX;
     while(pos < sz && OB_SUCCESS == ret) {
       int64_t wbytes = 0;
       if ((wbytes = ob_write_regard_ssl(fd_, buf + pos, sz - pos)) >= 0) {
         pos += wbytes;
         LOG_DEBUG("write fd", K(wbytes));
       } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
-        write_cond_.wait(1000 * 1000);
-        LOG_INFO("write cond wakeup");
+        const int64_t remain_us = timeout_ts - ObTimeUtility::current_time();
+        if (remain_us <= 0) {
+          ret = OB_TIMEOUT;
+          LOG_WARN("wait client writable timeout", K(ret), K_(fd), K(pos), K(sz), K(timeout_ts));
+        } else {
+          ObWaitEventGuard guard(ObWaitEventIds::MYSQL_RESPONSE_WAIT_CLIENT, 0, 0, 0);
+          write_cond_.wait(MIN(remain_us, WAIT_WRITABLE_INTERVAL_US));
+          LOG_INFO("write cond wakeup");
+        }
       } else if (EINTR == errno) {
         // pass
       } else {
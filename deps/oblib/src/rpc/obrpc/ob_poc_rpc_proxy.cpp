@@ -14,6 +14,7 @@
 #include "rpc/obrpc/ob_poc_rpc_server.h"
 #include "rpc/obrpc/ob_rpc_proxy.h"
 #include "rpc/obrpc/ob_net_keepalive.h"
+#include "lib/worker.h"
 extern "C" {
 #include "rpc/pnio/r0/futex.h"
 }
@@ -55,9 +56,20 @@ int ObSyncRespCallback::handle_resp(int io_err, const char* buf, int64_t sz)
 }
 int ObSyncRespCallback::wait()
 {
+  // The futex wait doesn't go through the pthread hooks, so mark the worker blocking
+  // here, and the tenant can run another worker on its token while this one waits
+  // for the response, as it does for the workers waiting on locks.
+  lib::Worker *worker = lib::Worker::self_;
+  const bool is_blocking = OB_NOT_NULL(worker) && worker->is_blocking();
+  if (OB_NOT_NULL(worker)) {
+    worker->set_is_blocking(true);
+  }
   while(ATOMIC_LOAD(&cond_) == 0) {
     rk_futex_wait(&cond_, 0, NULL);
   }
+  if (OB_NOT_NULL(worker)) {
+    worker->set_is_blocking(is_blocking);
+  }
   return send_ret_;
 }
 
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <map>
+#include <vector>
+#include "gtest/gtest.h"
+#include "lib/hash/ob_cow_pointer_hashmap.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace hash;
+
+struct PairValue
+{
+  PairValue() : key_(0), value_(0) {}
+  PairValue(const int64_t key, const int64_t value) : key_(key), value_(value) {}
+  int64_t get_key() const { return key_; }
+
+  int64_t key_;
+  int64_t value_;
+};
+
+template <class K, class V>
+struct GetKey
+{
+  K operator()(const V value) const
+  {
+    return value->get_key();
+  }
+};
+
+typedef ObCowPointerHashMap<int64_t, PairValue *, GetKey> CowMap;
+
+TEST(TestObCowPointerHashMap, basic_test)
+{
+  CowMap hashmap;
+  PairValue val1(1, 1);
+  PairValue val2(2, 2);
+  PairValue *val = NULL;
+  ASSERT_EQ(OB_SUCCESS, hashmap.init());
+  ASSERT_EQ(OB_HASH_NOT_EXIST, hashmap.get_refactored(1, val));
+  ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(1, &val1));
+  ASSERT_EQ(OB_HASH_EXIST, hashmap.set_refactored(1, &val1));
+  ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(1, &val1, 1));
+  ASSERT_EQ(OB_SUCCESS, hashmap.get_refactored(1, val));
+  ASSERT_EQ(1, val->value_);
+  ASSERT_EQ(1, (*hashmap.get(1))->value_);
+  ASSERT_EQ(1, hashmap.item_count());
+
+  ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(2, &val2));
+  ASSERT_EQ(OB_SUCCESS, hashmap.get_refactored(2, val));
+  ASSERT_EQ(2, val->value_);
+  ASSERT_EQ(2, hashmap.item_count());
+
+  ASSERT_EQ(OB_SUCCESS, hashmap.erase_refactored(2L));
+  ASSERT_EQ(OB_HASH_NOT_EXIST, hashmap.erase_refactored(2L));
+  ASSERT_EQ(OB_HASH_NOT_EXIST, hashmap.get_refactored(2, val));
+  ASSERT_EQ(1, hashmap.item_count());
+
+  hashmap.clear();
+  ASSERT_EQ(0, hashmap.count());
+  ASSERT_EQ(0, hashmap.item_count());
+}
+
+TEST(TestObCowPointerHashMap, test_large_pairs)
+{
+  CowMap hashmap;
+  const int64_t pair_count = 300000;
+  std::vector<PairValue> pairs(pair_count);
+  PairValue *val = NULL;
+  for (int64_t i = 0; i < pair_count; ++i) {
+    pairs[i].key_ = i;
+    pairs[i].value_ = i;
+    ASSERT_EQ(OB_SUCCESS, hashmap.set_refactored(pairs[i].key_, &pairs[i]));
+  }
+  ASSERT_EQ(pair_count, hashmap.item_count());
+  for (int64_t i = 0; i < pair_count; ++i) {
+    ASSERT_EQ(OB_SUCCESS, hashmap.get_refactored(pairs[i].key_, val));
+    ASSERT_EQ(i, val->value_);
+  }
+  for (int64_t i = 0; i < pair_count; i += 3) {
+    ASSERT_EQ(OB_SUCCESS, hashmap.erase_refactored(pairs[i].key_));
+  }
+  for (int64_t i = 0; i < pair_count; ++i) {
+    ASSERT_EQ(0 == i % 3 ? OB_HASH_NOT_EXIST : OB_SUCCESS,
+              hashmap.get_refactored(pairs[i].key_, val));
+  }
+  ASSERT_EQ(pair_count - (pair_count + 2) / 3, hashmap.item_count());
+}
+
+// versions created by assign() are not changed by the writes of the others
+TEST(TestObCowPointerHashMap, test_versions)
+{
+  const int64_t key_range = 20000;
+  const int64_t op_count = 100000;
+  std::vector<PairValue> pairs(op_count);
+  std::vector<CowMap *> versions;
+  std::vector<std::map<int64_t, PairValue *> > expects;
+  CowMap *hashmap = new CowMap();
+  std::map<int64_t, PairValue *> expect;
+  srandom(0);
+  for (int64_t i = 0; i < op_count; ++i) {
+    PairValue *pair = &pairs[i];
+    pair->key_ = random() % key_range;
+    pair->value_ = i;
+    const bool exist = expect.count(pair->key_) > 0;
+    if (random() % 3 < 2) {
+      const int overwrite = random() % 2;
+      if (exist && 0 == overwrite) {
+        ASSERT_EQ(OB_HASH_EXIST, hashmap->set_refactored(pair->key_, pair, overwrite));
+      } else {
+        ASSERT_EQ(OB_SUCCESS, hashmap->set_refactored(pair->key_, pair, overwrite));
+        expect[pair->key_] = pair;
+      }
+    } else {
+      ASSERT_EQ(exist ? OB_SUCCESS : OB_HASH_NOT_EXIST, hashmap->erase_refactored(pair->key_));
+      expect.erase(pair->key_);
+    }
+    if (0 == i % 5000) {
+      CowMap *version = new CowMap();
+      ASSERT_EQ(OB_SUCCESS, version->assign(*hashmap));
+      versions.push_back(version);
+      expects.push_back(expect);
+    }
+    if (0 == i % 20000 && versions.size() > 3) {
+      delete versions[0];
+      versions.erase(versions.begin());
+      expects.erase(expects.begin());
+    }
+  }
+  versions.push_back(hashmap);
+  expects.push_back(expect);
+  for (int64_t i = 0; i < versions.size(); ++i) {
+    ASSERT_EQ(expects[i].size(), versions[i]->item_count());
+    for (int64_t key = 0; key < key_range; ++key) {
+      PairValue *val = NULL;
+      if (expects[i].count(key) > 0) {
+        ASSERT_EQ(OB_SUCCESS, versions[i]->get_refactored(key, val));
+        ASSERT_EQ(expects[i][key], val);
+      } else {
+        ASSERT_EQ(OB_HASH_NOT_EXIST, versions[i]->get_refactored(key, val));
+      }
+    }
+  }
+  for (int64_t i = 0; i < versions.size(); ++i) {
+    delete versions[i];
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -47,6 +47,71 @@ struct ObCDCError
 
 typedef void (* ERROR_CALLBACK) (const ObCDCError &err);
 
+// Column type of ObCDCColumnVector
+enum ObCDCColumnType
+{
+  CDC_COLUMN_TYPE_INVALID = 0,
+  CDC_COLUMN_TYPE_INT64 = 1,      ///< int64_t
+  CDC_COLUMN_TYPE_UINT64 = 2,     ///< uint64_t
+  CDC_COLUMN_TYPE_FLOAT = 3,      ///< float
+  CDC_COLUMN_TYPE_DOUBLE = 4,     ///< double
+  CDC_COLUMN_TYPE_DATE = 5,       ///< int32_t, days since 1970-01-01
+  CDC_COLUMN_TYPE_DATETIME = 6,   ///< int64_t, microseconds since 1970-01-01 00:00:00 (UTC for TIMESTAMP)
+  CDC_COLUMN_TYPE_TIME = 7,       ///< int64_t, microseconds
+  CDC_COLUMN_TYPE_STRING = 8,     ///< string, same format as the column value of ICDCRecord
+};
+
+// One column of a IObCDCColumnBatch, memory is owned by the batch
+struct ObCDCColumnVector
+{
+  ObCDCColumnType type_;
+  int64_t row_count_;
+  const uint8_t *null_bitmap_;      ///< bit (i % 8) of byte (i / 8) is set if value of row i is NULL
+  const uint8_t *unchanged_bitmap_; ///< same layout, set if row i does not change the column and carries
+                                    ///< no value (UPDATE or DELETE without full column logging), the null
+                                    ///< bit is also set for such row
+  const void *values_;              ///< row_count_ fixed-width values, for types except STRING
+  const char *const *str_ptrs_;     ///< row_count_ string pointers, for STRING type
+  const int64_t *str_lens_;         ///< row_count_ string lengths, for STRING type
+
+  bool is_null(const int64_t row_idx) const
+  {
+    return 0 != (null_bitmap_[row_idx >> 3] & (1 << (row_idx & 7)));
+  }
+  bool is_unchanged(const int64_t row_idx) const
+  {
+    return 0 != (unchanged_bitmap_[row_idx >> 3] & (1 << (row_idx & 7)));
+  }
+};
+
+// DML rows of the same table in one transaction, output column by column
+class IObCDCColumnBatch
+{
+public:
+  virtual ~IObCDCColumnBatch() {};
+public:
+  // Row count. Non-DML record (BEGIN/COMMIT/DDL/HEARTBEAT) is output as a batch of one row without column
+  virtual int64_t get_row_count() const = 0;
+  virtual int64_t get_column_count() const = 0;
+
+  // ICDCRecord of row, for record type, table meta and checkpoint
+  // NOTE: records are released by release_column_batch(), DO NOT call release_record() on them
+  virtual ICDCRecord *get_record(const int64_t row_idx) const = 0;
+
+  /*
+   * get column values of all rows in batch
+   * @param [in]  column_idx      column index in table meta
+   * @param [in]  is_new_value    new value or old value of the column
+   * @param [out] vector          column values, valid until the batch is released
+   *
+   * @retval OB_SUCCESS           success
+   * @retval other error code     fail
+   */
+  virtual int get_column(const int64_t column_idx,
+      const bool is_new_value,
+      ObCDCColumnVector &vector) = 0;
+};
+
 class IObCDCInstance
 {
 public:
@@ -114,6 +179,28 @@ public:
    */
   virtual void release_record(ICDCRecord *record) = 0;
 
+  /*
+   * fetch next column batch, available only if enable_output_binary_column_batch=1
+   * consecutive DML records of the same table in one transaction are output in one batch
+   * @param [out] batch         column batch, must be released by release_column_batch
+   * @param [in]  max_row_count max row count of batch
+   * @param [in]  timeout_us    timeout to wait for the first record of batch
+   *
+   * @retval OB_SUCCESS         success
+   * @retval OB_TIMEOUT         timeout
+   * @retval OB_NOT_SUPPORTED   binary column batch output is not enabled
+   * @retval other error code   fail
+   */
+  virtual int next_column_batch(IObCDCColumnBatch *&batch,
+      const int64_t max_row_count,
+      const int64_t timeout_us) = 0;
+
+  /*
+   * release column batch and all records in it
+   * @param batch
+   */
+  virtual void release_column_batch(IObCDCColumnBatch *batch) = 0;
+
   /*
    * Launch libobcdc
    * @retval OB_SUCCESS on success
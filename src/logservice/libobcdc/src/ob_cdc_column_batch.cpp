@@ -0,0 +1,458 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Binary column batch output of libobcdc
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include "ob_cdc_column_batch.h"
+
+using namespace oceanbase::common;
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+
+void ObCDCRowColumns::reset()
+{
+  tenant_id_ = OB_INVALID_TENANT_ID;
+  table_id_ = OB_INVALID_ID;
+  table_version_ = OB_INVALID_VERSION;
+  column_num_ = 0;
+  contain_old_column_ = false;
+  new_objs_ = NULL;
+  old_objs_ = NULL;
+  new_strs_ = NULL;
+  old_strs_ = NULL;
+  new_unchanged_ = NULL;
+  old_unchanged_ = NULL;
+}
+
+int ObCDCRowColumns::init(ObIAllocator &allocator,
+    const uint64_t tenant_id,
+    const uint64_t table_id,
+    const int64_t table_version,
+    const int64_t column_num,
+    const bool contain_old_column)
+{
+  int ret = OB_SUCCESS;
+  const int64_t obj_array_size = column_num * sizeof(ObObj *);
+  const int64_t str_array_size = column_num * sizeof(ObString *);
+  const int64_t flag_array_size = column_num * sizeof(bool);
+  // new_objs, old_objs, new_strs, old_strs, new_unchanged, old_unchanged
+  const int64_t alloc_size = 2 * (obj_array_size + str_array_size + flag_array_size);
+  char *buf = NULL;
+
+  reset();
+
+  if (OB_UNLIKELY(column_num <= 0)) {
+    LOG_ERROR("invalid argument", K(column_num));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(alloc_size)))) {
+    LOG_ERROR("allocate memory for row columns fail", K(alloc_size), K(column_num));
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    (void)memset(buf, 0, alloc_size);
+    tenant_id_ = tenant_id;
+    table_id_ = table_id;
+    table_version_ = table_version;
+    column_num_ = column_num;
+    contain_old_column_ = contain_old_column;
+    new_objs_ = reinterpret_cast<const ObObj **>(buf);
+    old_objs_ = reinterpret_cast<const ObObj **>(buf + obj_array_size);
+    new_strs_ = reinterpret_cast<const ObString **>(buf + 2 * obj_array_size);
+    old_strs_ = reinterpret_cast<const ObString **>(buf + 2 * obj_array_size + str_array_size);
+    new_unchanged_ = reinterpret_cast<bool *>(buf + 2 * (obj_array_size + str_array_size));
+    old_unchanged_ = reinterpret_cast<bool *>(buf + 2 * (obj_array_size + str_array_size) + flag_array_size);
+  }
+
+  return ret;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+ObCDCColumnBatch::ObCDCColumnBatch() :
+    inited_(false),
+    max_row_count_(0),
+    row_count_(0),
+    records_(NULL),
+    rows_(NULL),
+    allocator_("CDCColBatch")
+{
+}
+
+ObCDCColumnBatch::~ObCDCColumnBatch()
+{
+  destroy();
+}
+
+int ObCDCColumnBatch::init(const int64_t max_row_count)
+{
+  int ret = OB_SUCCESS;
+  void *records_buf = NULL;
+  void *rows_buf = NULL;
+
+  if (OB_UNLIKELY(inited_)) {
+    LOG_ERROR("ObCDCColumnBatch init twice");
+    ret = OB_INIT_TWICE;
+  } else if (OB_UNLIKELY(max_row_count <= 0)) {
+    LOG_ERROR("invalid argument", K(max_row_count));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_ISNULL(records_buf = allocator_.alloc(max_row_count * sizeof(ICDCRecord *)))
+      || OB_ISNULL(rows_buf = allocator_.alloc(max_row_count * sizeof(ObCDCRowColumns *)))) {
+    LOG_ERROR("allocate memory for column batch fail", K(max_row_count));
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    records_ = static_cast<ICDCRecord **>(records_buf);
+    rows_ = static_cast<const ObCDCRowColumns **>(rows_buf);
+    max_row_count_ = max_row_count;
+    row_count_ = 0;
+    inited_ = true;
+  }
+
+  return ret;
+}
+
+void ObCDCColumnBatch::destroy()
+{
+  inited_ = false;
+  max_row_count_ = 0;
+  row_count_ = 0;
+  records_ = NULL;
+  rows_ = NULL;
+  allocator_.reset();
+}
+
+int64_t ObCDCColumnBatch::get_column_count() const
+{
+  int64_t column_count = 0;
+
+  if (row_count_ > 0 && NULL != rows_[0]) {
+    column_count = rows_[0]->column_num_;
+  }
+
+  return column_count;
+}
+
+ICDCRecord *ObCDCColumnBatch::get_record(const int64_t row_idx) const
+{
+  ICDCRecord *record = NULL;
+
+  if (row_idx >= 0 && row_idx < row_count_) {
+    record = records_[row_idx];
+  }
+
+  return record;
+}
+
+bool ObCDCColumnBatch::can_append(const ObCDCRowColumns *row_columns) const
+{
+  bool bool_ret = false;
+
+  if (! inited_ || is_full()) {
+    bool_ret = false;
+  } else if (is_empty()) {
+    bool_ret = true;
+  } else if (NULL == row_columns || NULL == rows_[0]) {
+    // non-DML record is output alone
+    bool_ret = false;
+  } else {
+    bool_ret = rows_[0]->is_same_table(*row_columns);
+  }
+
+  return bool_ret;
+}
+
+int ObCDCColumnBatch::append(ICDCRecord *record, const ObCDCRowColumns *row_columns)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(! inited_)) {
+    LOG_ERROR("ObCDCColumnBatch has not been initialized");
+    ret = OB_NOT_INIT;
+  } else if (OB_ISNULL(record)) {
+    LOG_ERROR("invalid argument", K(record));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_UNLIKELY(! can_append(row_columns))) {
+    LOG_ERROR("record can not be appended into column batch", KPC(this), KPC(row_columns));
+    ret = OB_ERR_UNEXPECTED;
+  } else {
+    records_[row_count_] = record;
+    rows_[row_count_] = row_columns;
+    row_count_++;
+  }
+
+  return ret;
+}
+
+bool ObCDCColumnBatch::is_native_obj_type(const ObObjType obj_type)
+{
+  return CDC_COLUMN_TYPE_STRING != get_column_type(obj_type);
+}
+
+ObCDCColumnType ObCDCColumnBatch::get_column_type(const ObObjType obj_type)
+{
+  ObCDCColumnType column_type = CDC_COLUMN_TYPE_STRING;
+
+  switch (ob_obj_type_class(obj_type)) {
+    case ObIntTC:
+      column_type = CDC_COLUMN_TYPE_INT64;
+      break;
+    case ObUIntTC:
+      column_type = CDC_COLUMN_TYPE_UINT64;
+      break;
+    case ObFloatTC:
+      column_type = CDC_COLUMN_TYPE_FLOAT;
+      break;
+    case ObDoubleTC:
+      column_type = CDC_COLUMN_TYPE_DOUBLE;
+      break;
+    case ObDateTC:
+      column_type = CDC_COLUMN_TYPE_DATE;
+      break;
+    case ObDateTimeTC:
+      column_type = CDC_COLUMN_TYPE_DATETIME;
+      break;
+    case ObTimeTC:
+      column_type = CDC_COLUMN_TYPE_TIME;
+      break;
+    default:
+      column_type = CDC_COLUMN_TYPE_STRING;
+      break;
+  }
+
+  return column_type;
+}
+
+void ObCDCColumnBatch::get_column_value_(const int64_t row_idx,
+    const int64_t column_idx,
+    const bool is_new_value,
+    const ObObj *&obj,
+    const ObString *&str,
+    bool &is_unchanged) const
+{
+  const ObCDCRowColumns *row = rows_[row_idx];
+
+  if (is_new_value) {
+    obj = row->new_objs_[column_idx];
+    str = row->new_strs_[column_idx];
+    is_unchanged = row->new_unchanged_[column_idx];
+  } else {
+    obj = row->old_objs_[column_idx];
+    str = row->old_strs_[column_idx];
+    is_unchanged = row->old_unchanged_[column_idx];
+  }
+}
+
+int ObCDCColumnBatch::get_column(const int64_t column_idx,
+    const bool is_new_value,
+    ObCDCColumnVector &vector)
+{
+  int ret = OB_SUCCESS;
+  ObCDCColumnType column_type = CDC_COLUMN_TYPE_INVALID;
+  const int64_t bitmap_size = (row_count_ + 7) / 8;
+  uint8_t *null_bitmap = NULL;
+  uint8_t *unchanged_bitmap = NULL;
+
+  if (OB_UNLIKELY(! inited_)) {
+    LOG_ERROR("ObCDCColumnBatch has not been initialized");
+    ret = OB_NOT_INIT;
+  } else if (OB_UNLIKELY(column_idx < 0 || column_idx >= get_column_count())) {
+    LOG_ERROR("invalid argument", K(column_idx), "column_count", get_column_count());
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_ISNULL(null_bitmap = static_cast<uint8_t *>(allocator_.alloc(bitmap_size)))
+      || OB_ISNULL(unchanged_bitmap = static_cast<uint8_t *>(allocator_.alloc(bitmap_size)))) {
+    LOG_ERROR("allocate memory for bitmap fail", K(bitmap_size));
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    (void)memset(null_bitmap, 0, bitmap_size);
+    (void)memset(unchanged_bitmap, 0, bitmap_size);
+
+    // Decide column type by non-NULL values, output as string if types are not consistent
+    for (int64_t row_idx = 0; row_idx < row_count_; row_idx++) {
+      const ObObj *obj = NULL;
+      const ObString *str = NULL;
+      bool is_unchanged = false;
+      ObCDCColumnType row_type = CDC_COLUMN_TYPE_INVALID;
+      get_column_value_(row_idx, column_idx, is_new_value, obj, str, is_unchanged);
+
+      if (is_unchanged) {
+        // no value, also marked as NULL
+        unchanged_bitmap[row_idx >> 3] |= static_cast<uint8_t>(1 << (row_idx & 7));
+      } else if (NULL != obj) {
+        row_type = obj->is_null() ? CDC_COLUMN_TYPE_INVALID : get_column_type(obj->get_type());
+      } else if (NULL != str && NULL != str->ptr()) {
+        row_type = CDC_COLUMN_TYPE_STRING;
+      }
+
+      if (CDC_COLUMN_TYPE_INVALID == row_type) {
+        null_bitmap[row_idx >> 3] |= static_cast<uint8_t>(1 << (row_idx & 7));
+      } else if (CDC_COLUMN_TYPE_INVALID == column_type) {
+        column_type = row_type;
+      } else if (column_type != row_type) {
+        column_type = CDC_COLUMN_TYPE_STRING;
+      }
+    }
+
+    if (CDC_COLUMN_TYPE_INVALID == column_type) {
+      // all values are NULL
+      column_type = CDC_COLUMN_TYPE_STRING;
+    }
+
+    vector.type_ = column_type;
+    vector.row_count_ = row_count_;
+    vector.null_bitmap_ = null_bitmap;
+    vector.unchanged_bitmap_ = unchanged_bitmap;
+    vector.values_ = NULL;
+    vector.str_ptrs_ = NULL;
+    vector.str_lens_ = NULL;
+
+    if (CDC_COLUMN_TYPE_STRING == column_type) {
+      const char **str_ptrs = NULL;
+      int64_t *str_lens = NULL;
+
+      if (OB_ISNULL(str_ptrs = static_cast<const char **>(allocator_.alloc(row_count_ * sizeof(char *))))
+          || OB_ISNULL(str_lens = static_cast<int64_t *>(allocator_.alloc(row_count_ * sizeof(int64_t))))) {
+        LOG_ERROR("allocate memory for string column fail", K(row_count_));
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+      }
+
+      for (int64_t row_idx = 0; OB_SUCC(ret) && row_idx < row_count_; row_idx++) {
+        const ObObj *obj = NULL;
+        const ObString *str = NULL;
+        bool is_unchanged = false;
+        get_column_value_(row_idx, column_idx, is_new_value, obj, str, is_unchanged);
+        str_ptrs[row_idx] = NULL;
+        str_lens[row_idx] = 0;
+
+        if (vector.is_null(row_idx)) {
+          // NULL
+        } else if (OB_FAIL(fill_string_value_(obj, str, row_idx, str_ptrs, str_lens))) {
+          LOG_ERROR("fill_string_value_ fail", KR(ret), K(row_idx), K(column_idx), KPC(obj));
+        }
+      }
+
+      if (OB_SUCC(ret)) {
+        vector.str_ptrs_ = str_ptrs;
+        vector.str_lens_ = str_lens;
+      }
+    } else {
+      const int64_t value_size = (CDC_COLUMN_TYPE_DATE == column_type || CDC_COLUMN_TYPE_FLOAT == column_type)
+          ? sizeof(int32_t) : sizeof(int64_t);
+      void *values = NULL;
+
+      if (OB_ISNULL(values = allocator_.alloc(row_count_ * value_size))) {
+        LOG_ERROR("allocate memory for native column fail", K(row_count_), K(value_size));
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+      } else {
+        (void)memset(values, 0, row_count_ * value_size);
+      }
+
+      for (int64_t row_idx = 0; OB_SUCC(ret) && row_idx < row_count_; row_idx++) {
+        const ObObj *obj = NULL;
+        const ObString *str = NULL;
+        bool is_unchanged = false;
+        get_column_value_(row_idx, column_idx, is_new_value, obj, str, is_unchanged);
+
+        if (vector.is_null(row_idx)) {
+          // NULL
+        } else if (OB_ISNULL(obj)) {
+          LOG_ERROR("obj is NULL for native column", K(row_idx), K(column_idx));
+          ret = OB_ERR_UNEXPECTED;
+        } else if (OB_FAIL(fill_native_value_(*obj, column_type, row_idx, values))) {
+          LOG_ERROR("fill_native_value_ fail", KR(ret), K(row_idx), K(column_idx), KPC(obj));
+        }
+      }
+
+      if (OB_SUCC(ret)) {
+        vector.values_ = values;
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCColumnBatch::fill_native_value_(const ObObj &obj,
+    const ObCDCColumnType type,
+    const int64_t row_idx,
+    void *values) const
+{
+  int ret = OB_SUCCESS;
+
+  switch (type) {
+    case CDC_COLUMN_TYPE_INT64:
+      static_cast<int64_t *>(values)[row_idx] = obj.get_int();
+      break;
+    case CDC_COLUMN_TYPE_UINT64:
+      static_cast<uint64_t *>(values)[row_idx] = obj.get_uint64();
+      break;
+    case CDC_COLUMN_TYPE_FLOAT:
+      static_cast<float *>(values)[row_idx] = obj.get_float();
+      break;
+    case CDC_COLUMN_TYPE_DOUBLE:
+      static_cast<double *>(values)[row_idx] = obj.get_double();
+      break;
+    case CDC_COLUMN_TYPE_DATE:
+      static_cast<int32_t *>(values)[row_idx] = obj.get_date();
+      break;
+    case CDC_COLUMN_TYPE_DATETIME:
+      // both DATETIME and TIMESTAMP are stored in microseconds, TIMESTAMP is in UTC
+      static_cast<int64_t *>(values)[row_idx] = obj.get_datetime();
+      break;
+    case CDC_COLUMN_TYPE_TIME:
+      static_cast<int64_t *>(values)[row_idx] = obj.get_time();
+      break;
+    default:
+      LOG_ERROR("not native column type", K(type), K(obj));
+      ret = OB_NOT_SUPPORTED;
+      break;
+  }
+
+  return ret;
+}
+
+int ObCDCColumnBatch::fill_string_value_(const ObObj *obj,
+    const ObString *str,
+    const int64_t row_idx,
+    const char **str_ptrs,
+    int64_t *str_lens)
+{
+  int ret = OB_SUCCESS;
+
+  if (NULL != obj && is_native_obj_type(obj->get_type())) {
+    // String conversion of native value was skipped by formatter, print it here.
+    // Only happens if types of one column are not consistent in batch
+    static const int64_t MAX_NATIVE_PRINT_LEN = 128;
+    char *buf = NULL;
+    int64_t pos = 0;
+
+    if (OB_ISNULL(buf = static_cast<char *>(allocator_.alloc(MAX_NATIVE_PRINT_LEN)))) {
+      LOG_ERROR("allocate memory fail", "size", MAX_NATIVE_PRINT_LEN);
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else if (OB_FAIL(obj->print_plain_str_literal(buf, MAX_NATIVE_PRINT_LEN, pos))) {
+      LOG_ERROR("print_plain_str_literal fail", KR(ret), KPC(obj));
+    } else {
+      str_ptrs[row_idx] = buf;
+      str_lens[row_idx] = pos;
+    }
+  } else if (NULL != str) {
+    str_ptrs[row_idx] = str->ptr();
+    str_lens[row_idx] = str->length();
+  }
+
+  return ret;
+}
+
+} // namespace libobcdc
+} // namespace oceanbase
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Binary column batch output of libobcdc
+ */
+
+#ifndef OCEANBASE_LIBOBCDC_COLUMN_BATCH_H_
+#define OCEANBASE_LIBOBCDC_COLUMN_BATCH_H_
+
+#include "libobcdc.h"                                   // IObCDCColumnBatch
+#include "common/object/ob_object.h"                    // ObObj
+#include "lib/allocator/page_arena.h"                   // ObArenaAllocator
+#include "lib/string/ob_string.h"                       // ObString
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+// Typed column values of one DML binlog record, filled by formatter
+// ObObj and ObString point to ColValue or LOB data of DmlStmtTask, which
+// are valid until the binlog record is released
+struct ObCDCRowColumns
+{
+  uint64_t tenant_id_;
+  uint64_t table_id_;
+  int64_t table_version_;
+  int64_t column_num_;
+  bool contain_old_column_;
+  // NULL ObObj means there is only string value, e.g. LOB stored out row
+  const common::ObObj **new_objs_;
+  const common::ObObj **old_objs_;
+  const common::ObString **new_strs_;
+  const common::ObString **old_strs_;
+  // the column is not changed by the row and has no value, e.g. UPDATE without full column logging
+  bool *new_unchanged_;
+  bool *old_unchanged_;
+
+  void reset();
+  int init(common::ObIAllocator &allocator,
+      const uint64_t tenant_id,
+      const uint64_t table_id,
+      const int64_t table_version,
+      const int64_t column_num,
+      const bool contain_old_column);
+  // rows of the same table with the same schema can be output in one column batch
+  bool is_same_table(const ObCDCRowColumns &other) const
+  {
+    return tenant_id_ == other.tenant_id_
+        && table_id_ == other.table_id_
+        && table_version_ == other.table_version_
+        && column_num_ == other.column_num_;
+  }
+
+  TO_STRING_KV(K_(tenant_id), K_(table_id), K_(table_version), K_(column_num), K_(contain_old_column));
+};
+
+class ObCDCColumnBatch : public IObCDCColumnBatch
+{
+public:
+  static const int64_t DEFAULT_MAX_ROW_COUNT = 1024;
+
+public:
+  ObCDCColumnBatch();
+  virtual ~ObCDCColumnBatch();
+  int init(const int64_t max_row_count);
+  void destroy();
+
+public:
+  virtual int64_t get_row_count() const { return row_count_; }
+  virtual int64_t get_column_count() const;
+  virtual ICDCRecord *get_record(const int64_t row_idx) const;
+  virtual int get_column(const int64_t column_idx,
+      const bool is_new_value,
+      ObCDCColumnVector &vector);
+
+public:
+  bool is_full() const { return row_count_ >= max_row_count_; }
+  bool is_empty() const { return 0 == row_count_; }
+  // Whether the record can be appended: batch is empty, or both the batch and the record are
+  // DML rows of the same table. row_columns is NULL for non-DML record
+  bool can_append(const ObCDCRowColumns *row_columns) const;
+  int append(ICDCRecord *record, const ObCDCRowColumns *row_columns);
+
+  // Types exported with native representation, string conversion of these types
+  // is skipped when enable_output_binary_column_batch=1
+  static bool is_native_obj_type(const common::ObObjType obj_type);
+  static ObCDCColumnType get_column_type(const common::ObObjType obj_type);
+
+  TO_STRING_KV(K_(max_row_count), K_(row_count));
+
+private:
+  void get_column_value_(const int64_t row_idx,
+      const int64_t column_idx,
+      const bool is_new_value,
+      const common::ObObj *&obj,
+      const common::ObString *&str,
+      bool &is_unchanged) const;
+  int fill_native_value_(const common::ObObj &obj,
+      const ObCDCColumnType type,
+      const int64_t row_idx,
+      void *values) const;
+  int fill_string_value_(const common::ObObj *obj,
+      const common::ObString *str,
+      const int64_t row_idx,
+      const char **str_ptrs,
+      int64_t *str_lens);
+
+private:
+  bool                    inited_;
+  int64_t                 max_row_count_;
+  int64_t                 row_count_;
+  ICDCRecord              **records_;
+  const ObCDCRowColumns   **rows_;
+  // memory of records_, rows_ and column vectors
+  common::ObArenaAllocator allocator_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObCDCColumnBatch);
+};
+
+} // namespace libobcdc
+} // namespace oceanbase
+
+#endif
@@ -32,6 +32,7 @@ ObLogBR::ObLogBR() : ObLogResourceRecycleTask(ObLogResourceRecycleTask::BINLOG_R
                      data_(nullptr),
                      host_(nullptr),
                      stmt_task_(nullptr),
+                     row_columns_(nullptr),
                      next_br_(nullptr),
                      valid_(true),
                      tenant_id_(OB_INVALID_TENANT_ID),
@@ -92,6 +93,7 @@ void ObLogBR::reset()
 
   host_ = nullptr;
   stmt_task_ = nullptr;
+  row_columns_ = nullptr;
   next_br_ = nullptr;
   valid_ = true;
   tenant_id_ = OB_INVALID_TENANT_ID;
@@ -28,6 +28,7 @@ namespace oceanbase
 {
 namespace libobcdc
 {
+struct ObCDCRowColumns;
 
 class ObLogBR : public ObLogResourceRecycleTask, public common::ObLink
 {
@@ -85,6 +86,10 @@ public:
   inline void *get_stmt_task() { return stmt_task_; }
   void set_stmt_task(void *stmt_task) { stmt_task_ = stmt_task; }
 
+  // typed column values for binary column batch, only set if enable_output_binary_column_batch=1
+  const ObCDCRowColumns *get_row_columns() const { return row_columns_; }
+  void set_row_columns(const ObCDCRowColumns *row_columns) { row_columns_ = row_columns; }
+
   uint64_t get_tenant_id() const { return tenant_id_; }
   int64_t get_schema_version() const { return schema_version_; }
   uint64_t get_row_index() const { return row_index_; }
@@ -113,6 +118,7 @@ private:
   IBinlogRecord *data_;               ///< real BinlogRecord
   void          *host_;               ///< record corresponsding ObLogEntryTask
   void          *stmt_task_;          // StmtTask
+  const ObCDCRowColumns *row_columns_; // memory is allocated from StmtTask
   ObLogBR       *next_br_;
   bool          valid_;               ///< statement is valid or not
 
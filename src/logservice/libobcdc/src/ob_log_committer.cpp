@@ -1284,6 +1284,7 @@ int ObLogCommitter::commit_binlog_record_list_(TransCtx &trans_ctx,
           K(ddl_schema_version), K(part_trans_task_count));
     } else {
       LOG_DEBUG("commit trans begin", K(trans_ctx));
+      const int64_t output_start_tstamp = get_timestamp();
       // push begin br to queue
       if (OB_FAIL(push_br_queue_(begin_br))) {
         if (OB_IN_STOP_STATE != ret) {
@@ -1328,6 +1329,8 @@ int ObLogCommitter::commit_binlog_record_list_(TransCtx &trans_ctx,
         } else if (trans_ctx.get_total_br_count() != trans_ctx.get_committed_br_count()) {
           ret = OB_ERR_UNEXPECTED;
           LOG_ERROR("expected all br commit but not", KR(ret), K(trans_ctx));
+        } else {
+          print_large_trans_lag_(trans_ctx, trans_commit_version, output_start_tstamp);
         }
       }
     }
@@ -1352,6 +1355,28 @@ int ObLogCommitter::commit_binlog_record_list_(TransCtx &trans_ctx,
   return ret;
 }
 
+// Large transaction is output while it is sorted, report the lag of each large transaction:
+// OUTPUT_TIME is the time spent to output all br of the transaction after BEGIN is output,
+// DELAY is the end-to-end lag from transaction commit to the output of COMMIT
+void ObLogCommitter::print_large_trans_lag_(const TransCtx &trans_ctx,
+    const int64_t trans_commit_version,
+    const int64_t output_start_tstamp) const
+{
+  const int64_t large_trans_br_count = TCONF.print_large_trans_lag_br_count;
+  const int64_t br_count = trans_ctx.get_total_br_count();
+
+  if (large_trans_br_count > 0 && br_count >= large_trans_br_count) {
+    const int64_t output_time = get_timestamp() - output_start_tstamp;
+
+    _LOG_INFO("[STAT] [LARGE_TRANS] TENANT=%lu TRANS_ID=%ld BR_COUNT=%ld OUTPUT_TIME=%.3lfs DELAY=%s",
+        trans_ctx.get_tenant_id(),
+        trans_ctx.get_trans_id().get_id(),
+        br_count,
+        static_cast<double>(output_time) / 1000000,
+        NTS_TO_DELAY(trans_commit_version));
+  }
+}
+
 int ObLogCommitter::next_ready_br_task_(TransCtx &trans_ctx, ObLogBR *&br_task)
 {
   int ret = OB_SUCCESS;
@@ -161,6 +161,9 @@ private:
   int update_tenant_trans_commit_version_(const PartTransTask &participants);
   int after_trans_handled_(PartTransTask *participants);
   int next_ready_br_task_(TransCtx &trans_ctx, ObLogBR *&br_task);
+  void print_large_trans_lag_(const TransCtx &trans_ctx,
+      const int64_t trans_commit_version,
+      const int64_t output_start_tstamp) const;
   int calculate_output_checkpoint_(int64_t &output_checkpoint);
 
 private:
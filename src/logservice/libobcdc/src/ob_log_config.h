@@ -363,6 +363,9 @@ public:
   // Print the number of LSs with the slowest progress of the Fetcher module
   T_DEF_INT_INFT(print_fetcher_slowest_ls_num, OB_CLUSTER_PARAMETER, 10, 1, "print fetcher slowest ls num");
 
+  // Print output lag of transaction whose br count is not less than the value, 0 to disable
+  T_DEF_INT_INFT(print_large_trans_lag_br_count, OB_CLUSTER_PARAMETER, 100000, 0, "print lag of large transaction");
+
   // Maximum number of RPC results per RPC
   T_DEF_INT_INFT(rpc_result_count_per_rpc_upper_limit, OB_CLUSTER_PARAMETER, 16, 1,
       "max rpc result count per rpc");
@@ -499,6 +502,14 @@ public:
   // 2. When configured on, the timestamp field is synchronized to integer
   T_DEF_BOOL(enable_convert_timestamp_to_unix_timestamp, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Whether to output DML rows as binary column batches (IObCDCInstance::next_column_batch)
+  // 1. off by default, every column is converted to string in the binlog record
+  // 2. When configured on, fixed-width columns(int/uint/float/double/date/datetime/time) are not
+  //    converted to string; they are exported with native representation in the column batch and
+  //    appear as empty string in the binlog record
+  // 3. Not supported together with enable_hbase_mode or enable_convert_timestamp_to_unix_timestamp
+  T_DEF_BOOL(enable_output_binary_column_batch, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
+
   // Whether to output invisible columns externally
   // 1. DRC link is off by default; if valid, output hidden primary key
   // 2. Backup is on by default
@@ -35,6 +35,7 @@
 #include "ob_cdc_lob_data_merger.h"     // IObCDCLobDataMerger
 #include "ob_cdc_lob_aux_meta_storager.h"    // ObCDCLobAuxMetaStorager
 #include "ob_cdc_lob_aux_table_parse.h"    // ObCDCLobAuxMetaStorager
+#include "ob_cdc_column_batch.h"        // ObCDCRowColumns
 
 using namespace oceanbase::common;
 using namespace oceanbase::storage;
@@ -57,6 +58,10 @@ void ObLogFormatter::RowValue::reset()
   (void)memset(new_columns_, 0, sizeof(new_columns_));
   (void)memset(old_columns_, 0, sizeof(old_columns_));
   (void)memset(orig_default_value_, 0, sizeof(orig_default_value_));
+  (void)memset(new_objs_, 0, sizeof(new_objs_));
+  (void)memset(old_objs_, 0, sizeof(old_objs_));
+  (void)memset(orig_default_objs_, 0, sizeof(orig_default_objs_));
+  dml_flag_ = ObDmlFlag::DF_NOT_EXIST;
   (void)memset(is_rowkey_, 0, sizeof(is_rowkey_));
   (void)memset(is_changed_, 0, sizeof(is_changed_));
 }
@@ -72,6 +77,10 @@ int ObLogFormatter::RowValue::init(const int64_t column_num, const bool contain_
     (void)memset(new_columns_, 0, column_num * sizeof(new_columns_[0]));
     (void)memset(old_columns_, 0, column_num * sizeof(old_columns_[0]));
     (void)memset(orig_default_value_, 0, column_num * sizeof(orig_default_value_[0]));
+    (void)memset(new_objs_, 0, column_num * sizeof(new_objs_[0]));
+    (void)memset(old_objs_, 0, column_num * sizeof(old_objs_[0]));
+    (void)memset(orig_default_objs_, 0, column_num * sizeof(orig_default_objs_[0]));
+    dml_flag_ = ObDmlFlag::DF_NOT_EXIST;
     (void)memset(is_rowkey_, 0, column_num * sizeof(is_rowkey_[0]));
     (void)memset(is_changed_, 0, column_num * sizeof(is_changed_[0]));
   }
@@ -754,6 +763,9 @@ int ObLogFormatter::format_row_(
         dml_stmt_task.get_dml_flag(),
         &table_schema))) {
       LOG_ERROR("build_binlog_record_ fail", KR(ret), K(br), K(row_value), K(new_column_cnt), K(dml_stmt_task));
+    } else if (obj2str_helper_->is_output_binary_column_batch_enabled()
+        && OB_FAIL(set_row_columns_(dml_stmt_task, row_value, br))) {
+      LOG_ERROR("set_row_columns_ fail", KR(ret), K(br), K(row_value), K(dml_stmt_task));
     } else {
       if (OB_NOT_NULL(br.get_data())
           && OB_UNLIKELY(SRC_FULL_RECORDED != br.get_data()->getSrcCategory())) {
@@ -1246,6 +1258,7 @@ int ObLogFormatter::fill_normal_cols_(
         } else if (is_new_value) {
           if (! cv->is_out_row_) {
             rv->new_columns_[usr_column_idx] = &cv->string_value_;
+            rv->new_objs_[usr_column_idx] = &cv->value_;
           } else {
             ObString *new_col_str = nullptr;
             if (OB_FAIL(lob_ctx_cols.get_lob_column_value(column_id, true/*is_new_col*/, new_col_str))) {
@@ -1282,6 +1295,7 @@ int ObLogFormatter::fill_normal_cols_(
         } else {
           if (! cv->is_out_row_) {
             rv->old_columns_[usr_column_idx] = &cv->string_value_;
+            rv->old_objs_[usr_column_idx] = &cv->value_;
           } else {
             ObString *old_col_str = nullptr;
             if (OB_FAIL(lob_ctx_cols.get_lob_column_value(column_id, false/*is_new_col*/, old_col_str))) {
@@ -1372,6 +1386,7 @@ int ObLogFormatter::fill_rowkey_cols_(
         // If the primary key column has been modified, the value after the modification is used, otherwise the value before the modification is used
         if (NULL == rv->new_columns_[rowkey_index]) {
           rv->new_columns_[rowkey_index] = &(cv_node->string_value_);
+          rv->new_objs_[rowkey_index] = &(cv_node->value_);
         }
 
         rv->is_rowkey_[rowkey_index] = true;
@@ -1379,6 +1394,7 @@ int ObLogFormatter::fill_rowkey_cols_(
 
         if (rv->contain_old_column_ && NULL == rv->old_columns_[rowkey_index]) {
           rv->old_columns_[rowkey_index] = &(cv_node->string_value_);
+          rv->old_objs_[rowkey_index] = &(cv_node->value_);
         }
       }
     } // for
@@ -1434,6 +1450,7 @@ int ObLogFormatter::fill_orig_default_value_(
         if (NULL != rv->new_columns_[usr_column_index]
             || NULL != rv->old_columns_[usr_column_index]) {
           rv->orig_default_value_[usr_column_index] = NULL;
+          rv->orig_default_objs_[usr_column_index] = NULL;
         } else {
           // default vlaue
           const common::ObString *orig_default_value_str = column_schema_info->get_orig_default_value_str();
@@ -1472,6 +1489,20 @@ int ObLogFormatter::fill_orig_default_value_(
             }
           }
 
+          // typed default value for binary column batch, fixed-width value needs no deep copy
+          const common::ObObj *orig_default_value_obj = column_schema_info->get_orig_default_value_obj();
+          common::ObObj *obj = NULL;
+
+          if (OB_FAIL(ret) || NULL == orig_default_value_obj) {
+            rv->orig_default_objs_[usr_column_index] = NULL;
+          } else if (OB_ISNULL(obj = static_cast<ObObj *>(allocator.alloc(sizeof(ObObj))))) {
+            LOG_ERROR("allocate memory for ObObj fail", K(sizeof(ObObj)));
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+          } else {
+            new (obj) ObObj(*orig_default_value_obj);
+            rv->orig_default_objs_[usr_column_index] = obj;
+          }
+
           if (OB_SUCC(ret)) {
             rv->orig_default_value_[usr_column_index] = str;
 
@@ -1517,6 +1548,76 @@ int ObLogFormatter::set_src_category_(IBinlogRecord *br_data,
   return ret;
 }
 
+int ObLogFormatter::set_row_columns_(
+    DmlStmtTask &dml_stmt_task,
+    const RowValue &row_value,
+    ObLogBR &br)
+{
+  int ret = OB_SUCCESS;
+  const int64_t column_num = row_value.column_num_;
+  ObIAllocator &allocator = dml_stmt_task.get_row_allocator();
+  ObCDCRowColumns *row_columns = NULL;
+
+  if (! br.is_valid() || column_num <= 0) {
+    // ignored row, no column to output
+  } else if (OB_ISNULL(row_columns = static_cast<ObCDCRowColumns *>(allocator.alloc(sizeof(ObCDCRowColumns))))) {
+    LOG_ERROR("allocate memory for ObCDCRowColumns fail", "size", sizeof(ObCDCRowColumns));
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else if (OB_FAIL(row_columns->init(allocator, dml_stmt_task.get_tenant_id(), dml_stmt_task.get_table_id(),
+      dml_stmt_task.get_table_version(), column_num, row_value.contain_old_column_))) {
+    LOG_ERROR("init row columns fail", KR(ret), K(dml_stmt_task), K(column_num));
+  } else {
+    fill_row_columns_(row_value, *row_columns);
+    br.set_row_columns(row_columns);
+  }
+
+  return ret;
+}
+
+void ObLogFormatter::fill_row_columns_(const RowValue &row_value, ObCDCRowColumns &row_columns)
+{
+  const ObDmlFlag dml_flag = row_value.dml_flag_;
+  const bool is_full_column = row_value.contain_old_column_;
+  const int64_t column_num = row_value.column_num_;
+
+  // Same values as format_dml_insert_, format_dml_update_ and format_dml_delete_
+  // put into binlog record
+  for (int64_t i = 0; i < column_num; i++) {
+    const bool is_changed = row_value.is_changed_[i];
+    const bool is_rowkey = row_value.is_rowkey_[i];
+
+    // new value
+    if (is_changed || ObDmlFlag::DF_DELETE == dml_flag) {
+      row_columns.new_objs_[i] = row_value.new_objs_[i];
+      row_columns.new_strs_[i] = row_value.new_columns_[i];
+    } else if (ObDmlFlag::DF_UPDATE == dml_flag && ! is_full_column) {
+      row_columns.new_unchanged_[i] = true;
+    } else if (ObDmlFlag::DF_UPDATE == dml_flag && NULL != row_value.old_columns_[i]) {
+      row_columns.new_objs_[i] = row_value.old_objs_[i];
+      row_columns.new_strs_[i] = row_value.old_columns_[i];
+    } else {
+      row_columns.new_objs_[i] = row_value.orig_default_objs_[i];
+      row_columns.new_strs_[i] = row_value.orig_default_value_[i];
+    }
+
+    // old value
+    if (ObDmlFlag::DF_INSERT == dml_flag) {
+      // no old value
+    } else if (ObDmlFlag::DF_DELETE == dml_flag && is_rowkey) {
+      row_columns.old_objs_[i] = row_value.new_objs_[i];
+      row_columns.old_strs_[i] = row_value.new_columns_[i];
+    } else if (! is_full_column) {
+      row_columns.old_unchanged_[i] = (ObDmlFlag::DF_DELETE == dml_flag) || ! (is_changed || is_rowkey);
+    } else if (NULL != row_value.old_columns_[i]) {
+      row_columns.old_objs_[i] = row_value.old_objs_[i];
+      row_columns.old_strs_[i] = row_value.old_columns_[i];
+    } else {
+      row_columns.old_objs_[i] = row_value.orig_default_objs_[i];
+      row_columns.old_strs_[i] = row_value.orig_default_value_[i];
+    }
+  }
+}
+
 template<class TABLE_SCHEMA>
 int ObLogFormatter::build_binlog_record_(
     ObLogBR *br,
@@ -1583,6 +1684,8 @@ int ObLogFormatter::build_binlog_record_(
         }
       }
 
+      rv->dml_flag_ = current_dml_flag;
+
       switch (current_dml_flag) {
       case ObDmlFlag::DF_DELETE: {
         ret = format_dml_delete_(br_data, rv);
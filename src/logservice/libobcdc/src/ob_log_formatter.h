@@ -81,6 +81,7 @@ class ObObj2strHelper;
 class IObLogBRPool;
 class ObLogSchemaGuard;
 class ObDictTenantInfoGuard;
+struct ObCDCRowColumns;
 
 typedef common::ObMQThread<IObLogFormatter::MAX_FORMATTER_NUM, IObLogFormatter> FormatterThread;
 
@@ -130,6 +131,12 @@ private:
     common::ObString *new_columns_[common::OB_MAX_COLUMN_NUMBER];
     common::ObString *old_columns_[common::OB_MAX_COLUMN_NUMBER];
     common::ObString *orig_default_value_[common::OB_MAX_COLUMN_NUMBER];
+    // typed values for binary column batch, NULL if only string value is available
+    const common::ObObj *new_objs_[common::OB_MAX_COLUMN_NUMBER];
+    const common::ObObj *old_objs_[common::OB_MAX_COLUMN_NUMBER];
+    const common::ObObj *orig_default_objs_[common::OB_MAX_COLUMN_NUMBER];
+    // DML type output in binlog record, UPDATE is output as INSERT in HBase put mode
+    blocksstable::ObDmlFlag dml_flag_;
 
     bool is_rowkey_[common::OB_MAX_COLUMN_NUMBER];
     bool is_changed_[common::OB_MAX_COLUMN_NUMBER];
@@ -242,6 +249,13 @@ private:
       ColValueList &rowkey_cols,
       const TABLE_SCHEMA *simple_table_schema,
       const TableSchemaInfo &tb_schema_info);
+  // Export typed column values of row into binlog record for binary column batch
+  int set_row_columns_(
+      DmlStmtTask &dml_stmt_task,
+      const RowValue &row_value,
+      ObLogBR &br);
+  // Fill typed column values with the same values put into binlog record
+  static void fill_row_columns_(const RowValue &row_value, ObCDCRowColumns &row_columns);
   template<class TABLE_SCHEMA>
   int build_binlog_record_(
       ObLogBR *br,
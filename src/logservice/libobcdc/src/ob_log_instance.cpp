@@ -56,6 +56,7 @@
 #include "ob_log_start_schema_matcher.h"  // ObLogStartSchemaMatcher
 #include "ob_log_tenant_mgr.h"            // IObLogTenantMgr
 #include "ob_log_rocksdb_store_service.h" // RocksDbStoreService
+#include "ob_cdc_column_batch.h"          // ObCDCColumnBatch
 
 #include "ob_log_trace_id.h"
 #include "share/ob_simple_mem_limit_getter.h"
@@ -162,6 +163,8 @@ ObLogInstance::ObLogInstance() :
     hbase_util_(),
     obj2str_helper_(),
     br_queue_(),
+    pending_batch_record_(NULL),
+    column_batch_lock_(),
     trans_task_pool_(),
     log_entry_task_pool_(NULL),
     store_service_(NULL),
@@ -692,6 +695,7 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   bool enable_backup_mode = (TCONF.enable_backup_mode != 0);
   bool skip_hbase_mode_put_column_count_not_consistency = (TCONF.skip_hbase_mode_put_column_count_not_consistency != 0);
   bool enable_convert_timestamp_to_unix_timestamp = (TCONF.enable_convert_timestamp_to_unix_timestamp != 0);
+  bool enable_output_binary_column_batch = (TCONF.enable_output_binary_column_batch != 0);
   bool enable_output_hidden_primary_key = (TCONF.enable_output_hidden_primary_key != 0);
   bool enable_oracle_mode_match_case_sensitive = (TCONF.enable_oracle_mode_match_case_sensitive != 0);
   const char *rs_list = TCONF.rootserver_list.str();
@@ -925,10 +929,28 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
 
   // After initializing the timezone info getter successfully, initialize the obj2str_helper_
   if (OB_SUCC(ret)) {
-    if (OB_FAIL(obj2str_helper_.init(*timezone_info_getter_, hbase_util_, enable_hbase_mode,
-            enable_convert_timestamp_to_unix_timestamp, enable_backup_mode, *tenant_mgr_))) {
+    // Typed column values reference memory of DmlStmtTask, which is not available after
+    // binlog record is persisted in storage working mode
+    if (enable_output_binary_column_batch && ! is_memory_working_mode(working_mode_)) {
+      LOG_WARN("binary column batch output is only supported in memory working mode, disable it",
+          "working_mode", print_working_mode(working_mode_));
+      enable_output_binary_column_batch = false;
+    }
+
+    // Native typed values of the binary column batch are not converted to string, so the
+    // value transforms of the string conversion can not be applied to them
+    if (enable_output_binary_column_batch
+        && (enable_hbase_mode || enable_convert_timestamp_to_unix_timestamp)) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_ERROR("binary column batch output is not supported together with enable_hbase_mode "
+          "or enable_convert_timestamp_to_unix_timestamp", KR(ret), K(enable_hbase_mode),
+          K(enable_convert_timestamp_to_unix_timestamp));
+    } else if (OB_FAIL(obj2str_helper_.init(*timezone_info_getter_, hbase_util_, enable_hbase_mode,
+            enable_convert_timestamp_to_unix_timestamp, enable_backup_mode,
+            enable_output_binary_column_batch, *tenant_mgr_))) {
       LOG_ERROR("init obj2str_helper fail", KR(ret), K(enable_hbase_mode),
-          K(enable_convert_timestamp_to_unix_timestamp), K(enable_backup_mode));
+          K(enable_convert_timestamp_to_unix_timestamp), K(enable_backup_mode),
+          K(enable_output_binary_column_batch));
     }
   }
 
@@ -1216,6 +1238,11 @@ void ObLogInstance::destroy()
 {
   do_stop_("DESTROY_OBCDC");
 
+  if (NULL != pending_batch_record_) {
+    release_record(pending_batch_record_);
+    pending_batch_record_ = NULL;
+  }
+
   inited_ = false;
 
   oblog_major_ = 0;
@@ -1790,6 +1817,87 @@ void ObLogInstance::release_record(IBinlogRecord *record)
   }
 }
 
+int ObLogInstance::next_column_batch(IObCDCColumnBatch *&batch,
+    const int64_t max_row_count,
+    const int64_t timeout_us)
+{
+  int ret = OB_SUCCESS;
+  const int64_t batch_max_row_count = max_row_count > 0 ? max_row_count : ObCDCColumnBatch::DEFAULT_MAX_ROW_COUNT;
+  ObCDCColumnBatch *column_batch = NULL;
+  batch = NULL;
+
+  if (OB_UNLIKELY(! inited_)) {
+    LOG_ERROR("instance has not been initialized");
+    ret = OB_NOT_INIT;
+  } else if (OB_UNLIKELY(! obj2str_helper_.is_output_binary_column_batch_enabled())) {
+    LOG_WARN("binary column batch output is not enabled, use next_record instead");
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_ISNULL(column_batch = OB_NEW(ObCDCColumnBatch, "CDCColBatch"))) {
+    LOG_ERROR("allocate memory for column batch fail");
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else if (OB_FAIL(column_batch->init(batch_max_row_count))) {
+    LOG_ERROR("init column batch fail", KR(ret), K(batch_max_row_count));
+  } else {
+    lib::ObMutexGuard guard(column_batch_lock_);
+    // only wait for the first record, the batch is ended by the first record not ready
+    int64_t wait_timeout_us = timeout_us;
+    bool batch_end = false;
+
+    while (OB_SUCC(ret) && ! batch_end) {
+      IBinlogRecord *record = pending_batch_record_;
+      pending_batch_record_ = NULL;
+
+      if (NULL == record && OB_FAIL(next_record(&record, wait_timeout_us))) {
+        if (OB_TIMEOUT != ret && OB_IN_STOP_STATE != ret) {
+          LOG_ERROR("next_record fail", KR(ret), K(wait_timeout_us));
+        }
+      } else {
+        ObLogBR *br = reinterpret_cast<ObLogBR *>(record->getUserData());
+        const ObCDCRowColumns *row_columns = (NULL == br) ? NULL : br->get_row_columns();
+
+        if (! column_batch->can_append(row_columns)) {
+          pending_batch_record_ = record;
+          batch_end = true;
+        } else if (OB_FAIL(column_batch->append(record, row_columns))) {
+          LOG_ERROR("append record into column batch fail", KR(ret), KPC(column_batch), KPC(row_columns));
+          release_record(record);
+        } else {
+          // non-DML record is output alone
+          batch_end = (NULL == row_columns || column_batch->is_full());
+        }
+      }
+
+      wait_timeout_us = 0;
+    }
+
+    if (OB_TIMEOUT == ret && ! column_batch->is_empty()) {
+      ret = OB_SUCCESS;
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    batch = column_batch;
+  } else if (NULL != column_batch) {
+    release_column_batch(column_batch);
+    column_batch = NULL;
+  }
+
+  return ret;
+}
+
+void ObLogInstance::release_column_batch(IObCDCColumnBatch *batch)
+{
+  if (NULL != batch) {
+    ObCDCColumnBatch *column_batch = static_cast<ObCDCColumnBatch *>(batch);
+
+    for (int64_t row_idx = 0; row_idx < column_batch->get_row_count(); row_idx++) {
+      release_record(column_batch->get_record(row_idx));
+    }
+
+    OB_DELETE(ObCDCColumnBatch, "CDCColBatch", column_batch);
+  }
+}
+
 void ObLogInstance::handle_error(const int err_no, const char *fmt, ...)
 {
   static const int64_t MAX_ERR_MSG_LEN = 1024;
@@ -19,6 +19,7 @@
 
 #include "lib/allocator/ob_concurrent_fifo_allocator.h"   // ObConcurrentFIFOAllocator
 #include "lib/alloc/memory_dump.h"                        // memory_meta_dump
+#include "lib/lock/ob_mutex.h"                             // ObMutex
 
 #include "ob_log_binlog_record.h"                         // ObLogBR
 #include "ob_log_fetching_mode.h"
@@ -138,6 +139,10 @@ public:
       uint64_t &tenant_id,
       const int64_t timeout_us);
   virtual void release_record(IBinlogRecord *record);
+  virtual int next_column_batch(IObCDCColumnBatch *&batch,
+      const int64_t max_row_count,
+      const int64_t timeout_us);
+  virtual void release_column_batch(IObCDCColumnBatch *batch);
   virtual int launch();
   virtual void stop();
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids);
@@ -327,6 +332,10 @@ public:
   ObLogHbaseUtil            hbase_util_;
   ObObj2strHelper           obj2str_helper_;
   BRQueue                   br_queue_;
+  // record popped by next_column_batch() but not belong to the batch, output in next batch
+  IBinlogRecord             *pending_batch_record_;
+  // a sleeping lock, next_record() may block while it is held
+  lib::ObMutex              column_batch_lock_;
   PartTransTaskPool         trans_task_pool_;
   IObLogEntryTaskPool       *log_entry_task_pool_;
   IObStoreService           *store_service_;
@@ -587,7 +587,11 @@ int MutatorRow::add_column_(
     // convert obj to string if obj2str_helper is valid
     // no deep copy of string required
     // note: currently DML must pass into obj2str_helperd
-    if (NULL != obj2str_helper && ! is_out_row && OB_FAIL(obj2str_helper->obj2str(tenant_id,
+    if (NULL == obj2str_helper || is_out_row) {
+      // do nothing
+    } else if (obj2str_helper->need_skip_obj2str(cv_node->value_)) {
+      cv_node->string_value_.assign_ptr(ObObj2strHelper::EMPTY_STRING, 0);
+    } else if (OB_FAIL(obj2str_helper->obj2str(tenant_id,
         table_id,
         column_id,
         cv_node->value_,
@@ -600,7 +604,9 @@ int MutatorRow::add_column_(
         tz_info_wrap))) {
       LOG_ERROR("obj2str fail", KR(ret),
           "obj", *value, K(obj2str_helper), K(accuracy), K(collation_type), K(column_id), K(column_schema_info));
-    } else if (OB_FAIL(cols.add(cv_node))) {
+    }
+
+    if (OB_SUCC(ret) && OB_FAIL(cols.add(cv_node))) {
       LOG_ERROR("add column into ColValueList fail", KR(ret), "column_value", *cv_node, K(cols));
     }
   }
@@ -1082,7 +1088,9 @@ int DmlStmtTask::parse_col(
   accuracy = column_schema_info.get_accuracy();
   collation_type = column_schema_info.get_collation_type();
 
-  if (OB_FAIL(obj2str_helper.obj2str(tenant_id,
+  if (obj2str_helper.need_skip_obj2str(cv_node.value_)) {
+    cv_node.string_value_.assign_ptr(ObObj2strHelper::EMPTY_STRING, 0);
+  } else if (OB_FAIL(obj2str_helper.obj2str(tenant_id,
       table_id_,
       column_id,
       cv_node.value_,
@@ -452,6 +452,8 @@ public:
   }
 
   ObLobDataOutRowCtxList &get_new_lob_ctx_cols() { return row_.get_new_lob_ctx_cols(); }
+  // Memory allocated is released together with the row
+  common::ObIAllocator &get_row_allocator() { return row_.get_allocator(); }
 
   ObLogEntryTask &get_redo_log_entry_task() { return log_entry_task_; }
 
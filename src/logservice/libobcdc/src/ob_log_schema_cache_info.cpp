@@ -16,6 +16,7 @@
 
 #include "ob_log_schema_cache_info.h"
 #include "ob_obj2str_helper.h"                    // ObObj2strHelper
+#include "ob_cdc_column_batch.h"                  // ObCDCColumnBatch
 #include "ob_log_utils.h"                         // filter_non_user_column
 #include "ob_log_config.h"                        // TCONF
 #include "ob_log_meta_data_refresh_mode.h"        // RefreshMode
@@ -40,6 +41,7 @@ ColumnSchemaInfo::ColumnSchemaInfo()
       accuracy_(),
       collation_type_(),
       orig_default_value_str_(NULL),
+      orig_default_value_obj_(),
       extended_type_info_size_(0),
       extended_type_info_(NULL),
       is_rowkey_(false)
@@ -109,6 +111,9 @@ int ColumnSchemaInfo::init(
     accuracy_ = accuracy;
     collation_type_ =  collation_type;
     orig_default_value_str_ = orig_default_value_str;
+    if (ObCDCColumnBatch::is_native_obj_type(column_table_schema.get_orig_default_value().get_type())) {
+      orig_default_value_obj_ = column_table_schema.get_orig_default_value();
+    }
     is_rowkey_ = column_table_schema.is_original_rowkey_column();
   }
 
@@ -136,6 +141,7 @@ void ColumnSchemaInfo::reset()
     orig_default_value_str_ = NULL;
   }
 
+  orig_default_value_obj_.reset();
   extended_type_info_size_ = 0;
   extended_type_info_ = NULL;
   is_rowkey_ = false;
@@ -100,6 +100,10 @@ public:
     orig_default_value_str_ = &orig_default_value_str;
   }
   inline const common::ObString *get_orig_default_value_str() const { return orig_default_value_str_; }
+  // typed default value for binary column batch, NULL if the default value is NULL or
+  // not a fixed-width type, in which case the string value is used
+  inline const common::ObObj *get_orig_default_value_obj() const
+  { return orig_default_value_obj_.is_null() ? NULL : &orig_default_value_obj_; }
   // 1. To resolve the memory space, ObArrayHelper is not used directly to store information, get_extended_type_info returns size and an array of pointers directly
   // 2. call ObArrayHelper<ObString>(size, str_ptr, size) directly from the outer layer to construct a temporary array
   inline void get_extended_type_info(int64_t &size, common::ObString *&str_ptr) const
@@ -153,6 +157,8 @@ private:
   common::ObCollationType collation_type_;
   // TODO: There are no multiple versions of the default value, consider maintaining a copy
   common::ObString   *orig_default_value_str_;
+  // only fixed-width value is kept, no memory to release
+  common::ObObj      orig_default_value_obj_;
   // used for enum and set
   int64_t            extended_type_info_size_;
   common::ObString   *extended_type_info_;
@@ -243,6 +243,9 @@ int ObLogStorager::handle_task_(IObLogBatchBufTask &batch_task,
     IObLogBufTask *curr_task = batch_task.get_header_task();
     IObLogBufTask *next_task = NULL;
     int64_t task_num = 0;
+    // Store tasks of the same column family are written with one WriteBatch instead of
+    // one put per task, flushed when column family changes or batch is large enough
+    StoreWriteBatch write_batch;
 
     while (OB_SUCC(ret) && ! stop_flag && NULL != curr_task) {
       next_task = curr_task->next_;
@@ -266,18 +269,26 @@ int ObLogStorager::handle_task_(IObLogBatchBufTask &batch_task,
 
           if (OB_FAIL(store_key.get_key(key))) {
             LOG_ERROR("store_key get_key fail", KR(ret));
+          } else if (! write_batch.is_empty() && write_batch.cf_handle_ != column_family_handle
+              && OB_FAIL(flush_write_batch_(write_batch, thread_index))) {
+            LOG_ERROR("flush_write_batch_ fail", KR(ret), K(thread_index));
           } else {
             const offset_t start_pos = store_task->get_offset();
             const int64_t data_len = store_task->get_data_len();
 
-            if (OB_FAIL(write_store_service_(key.c_str(), batch_buf + start_pos, data_len,
-                    column_family_handle, thread_index))) {
-              LOG_ERROR("write_store_service_ fail", KR(ret), K(store_task));
-            } else if (OB_FAIL(store_task->st_after_consume(OB_SUCCESS))) {
-              LOG_ERROR("st_after_consume fail", KR(ret));
+            if (OB_UNLIKELY(data_len <= 0)) {
+              LOG_ERROR("invalid store task data", K(start_pos), K(data_len), KPC(store_task));
+              ret = OB_INVALID_ARGUMENT;
             } else {
-              ObLogStoreTaskFactory::free(store_task);
-              store_task = NULL;
+              write_batch.cf_handle_ = column_family_handle;
+              write_batch.keys_.push_back(key);
+              write_batch.values_.push_back(ObSlice(batch_buf + start_pos, data_len));
+              write_batch.tasks_.push_back(store_task);
+              write_batch.data_size_ += data_len;
+
+              if (write_batch.is_full() && OB_FAIL(flush_write_batch_(write_batch, thread_index))) {
+                LOG_ERROR("flush_write_batch_ fail", KR(ret), K(thread_index));
+              }
             }
           }
         }
@@ -289,6 +300,18 @@ int ObLogStorager::handle_task_(IObLogBatchBufTask &batch_task,
       }
     } // while
 
+    // Tasks already added to the write batch must not be left behind when the loop breaks
+    // for stop_flag or an error: flush them if possible, otherwise fail and release them
+    if (OB_SUCC(ret) && ! write_batch.is_empty()) {
+      if (OB_FAIL(flush_write_batch_(write_batch, thread_index))) {
+        LOG_ERROR("flush_write_batch_ fail", KR(ret), K(thread_index), K(stop_flag));
+      }
+    }
+
+    if (OB_FAIL(ret) && ! write_batch.is_empty()) {
+      fail_write_batch_(write_batch, ret);
+    }
+
     if (OB_SUCC(ret)) {
       if (is_big_block) {
         BigBlock *big_block = static_cast<BigBlock *>(&batch_task);
@@ -319,35 +342,63 @@ int ObLogStorager::handle_task_(IObLogBatchBufTask &batch_task,
   return ret;
 }
 
-int ObLogStorager::write_store_service_(const char *key,
-    const char *log_str,
-    const size_t log_str_len,
-    void *column_family_handle,
-    const int64_t thread_index)
+int ObLogStorager::flush_write_batch_(StoreWriteBatch &write_batch, const int64_t thread_index)
 {
   int ret = OB_SUCCESS;
+  const int64_t task_count = static_cast<int64_t>(write_batch.tasks_.size());
 
   if (OB_UNLIKELY(! inited_)) {
     LOG_ERROR("ObLogStorager has not been initialized");
     ret = OB_NOT_INIT;
-  } else if (OB_ISNULL(key) || OB_ISNULL(log_str) || OB_UNLIKELY(log_str_len <= 0)) {
-    LOG_ERROR("invalid argument");
-    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_FAIL(store_service_->batch_write(write_batch.cf_handle_, write_batch.keys_, write_batch.values_))) {
+    LOG_ERROR("store_service_ batch_write fail", KR(ret), K(thread_index), K(task_count),
+        "data_size", write_batch.data_size_);
   } else {
-    if (OB_FAIL(store_service_->put(column_family_handle, key, ObSlice(log_str, log_str_len)))) {
-      LOG_ERROR("store_service_ put fail", KR(ret), K(thread_index), K(key), K(log_str_len));
-    } else {
-      // Statistics rps
-      rps_stat_.do_rps_stat(1);
-      store_service_stat_.do_data_stat(log_str_len);
+    // Statistics rps
+    rps_stat_.do_rps_stat(task_count);
+    store_service_stat_.do_data_stat(write_batch.data_size_);
+
+    LOG_DEBUG("store_service_ batch_write succ", K(thread_index), K(task_count), "data_size", write_batch.data_size_);
+
+    // Notify after data of all tasks is persisted
+    for (int64_t idx = 0; OB_SUCC(ret) && idx < task_count; ++idx) {
+      ObLogStoreTask *store_task = write_batch.tasks_[idx];
+
+      if (OB_FAIL(store_task->st_after_consume(OB_SUCCESS))) {
+        LOG_ERROR("st_after_consume fail", KR(ret), K(idx), K(task_count));
+      } else {
+        ObLogStoreTaskFactory::free(store_task);
+        write_batch.tasks_[idx] = NULL;
+      }
+    }
 
-      LOG_DEBUG("store_service_ put succ", K(key), K(log_str_len));
+    if (OB_SUCC(ret)) {
+      write_batch.reset();
     }
   }
 
   return ret;
 }
 
+void ObLogStorager::fail_write_batch_(StoreWriteBatch &write_batch, const int handle_err)
+{
+  const int64_t task_count = static_cast<int64_t>(write_batch.tasks_.size());
+
+  for (int64_t idx = 0; idx < task_count; ++idx) {
+    ObLogStoreTask *store_task = write_batch.tasks_[idx];
+
+    // Tasks that have been notified are already released
+    if (NULL != store_task) {
+      (void)store_task->st_after_consume(handle_err);
+      ObLogStoreTaskFactory::free(store_task);
+      write_batch.tasks_[idx] = NULL;
+    }
+  }
+
+  LOG_WARN_RET(handle_err, "fail pending store tasks of write batch", K(handle_err), K(task_count));
+  write_batch.reset();
+}
+
 void ObLogStorager::print_task_count_()
 {
   int ret = OB_SUCCESS;
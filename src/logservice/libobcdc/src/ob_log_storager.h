@@ -19,6 +19,7 @@
 #include "ob_log_trans_stat_mgr.h"                  // TransRpsStatInfo
 #include "ob_log_store_service_stat.h"              // StoreServiceStatInfo
 #include "ob_log_batch_buffer.h"                    // IObLogBatchBufTask, IObBatchBufferConsumer
+#include "ob_log_store_service.h"                   // ObSlice
 
 namespace oceanbase
 {
@@ -52,6 +53,7 @@ public:
 
 class IObStoreService;
 class IObLogErrHandler;
+class ObLogStoreTask;
 
 typedef common::ObMQThread<IObLogStorager::MAX_STORAGER_NUM> StoragerThread;
 
@@ -82,6 +84,35 @@ public:
 
 private:
   static const int64_t DATA_OP_TIMEOUT = 1 * 1000 * 1000;
+  // Limit of one WriteBatch
+  static const int64_t MAX_WRITE_BATCH_TASK_COUNT = 1024;
+  static const int64_t MAX_WRITE_BATCH_DATA_SIZE = 16 * _M_;
+
+  // Store tasks of one column family to be written together
+  struct StoreWriteBatch
+  {
+    void                          *cf_handle_;
+    std::vector<std::string>      keys_;
+    std::vector<ObSlice>          values_;
+    std::vector<ObLogStoreTask *> tasks_;
+    int64_t                       data_size_;
+
+    StoreWriteBatch() : cf_handle_(NULL), keys_(), values_(), tasks_(), data_size_(0) {}
+    void reset()
+    {
+      cf_handle_ = NULL;
+      keys_.clear();
+      values_.clear();
+      tasks_.clear();
+      data_size_ = 0;
+    }
+    bool is_empty() const { return tasks_.empty(); }
+    bool is_full() const
+    {
+      return static_cast<int64_t>(tasks_.size()) >= MAX_WRITE_BATCH_TASK_COUNT
+          || data_size_ >= MAX_WRITE_BATCH_DATA_SIZE;
+    }
+  };
   static const int64_t PRINT_TASK_COUNT_INTERVAL = 10 * _SEC_;
   static const int64_t PRINT_RPS_STAT_INTERVAL   = 10 * _SEC_;
 
@@ -89,11 +120,8 @@ private:
   int handle_task_(IObLogBatchBufTask &batch_task,
       const int64_t thread_index,
       volatile bool &stop_flag);
-  int write_store_service_(const char *key,
-      const char *log_str,
-      const size_t log_str_len,
-      void *column_family_handle,
-      const int64_t thread_index);
+  int flush_write_batch_(StoreWriteBatch &write_batch, const int64_t thread_index);
+  void fail_write_batch_(StoreWriteBatch &write_batch, const int handle_err);
 
   void print_task_count_();
   void print_rps_();
@@ -26,6 +26,7 @@
 #include "sql/engine/expr/ob_expr_res_type_map.h"
 
 #include "ob_log_utils.h"                           // _M_
+#include "ob_cdc_column_batch.h"                    // ObCDCColumnBatch
 
 using namespace oceanbase::common;
 namespace oceanbase
@@ -40,6 +41,7 @@ ObObj2strHelper::ObObj2strHelper() : inited_(false),
                                      enable_hbase_mode_(false),
                                      enable_convert_timestamp_to_unix_timestamp_(false),
                                      enable_backup_mode_(false),
+                                     enable_output_binary_column_batch_(false),
                                      tenant_mgr_(NULL)
 {
 }
@@ -54,6 +56,7 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     const bool enable_hbase_mode,
     const bool enable_convert_timestamp_to_unix_timestamp,
     const bool enable_backup_mode,
+    const bool enable_output_binary_column_batch,
     IObLogTenantMgr &tenant_mgr)
 {
   int ret = OB_SUCCESS;
@@ -68,6 +71,7 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     enable_hbase_mode_ = enable_hbase_mode;
     enable_convert_timestamp_to_unix_timestamp_ = enable_convert_timestamp_to_unix_timestamp;
     enable_backup_mode_ = enable_backup_mode;
+    enable_output_binary_column_batch_ = enable_output_binary_column_batch;
     tenant_mgr_ = &tenant_mgr;
     inited_ = true;
   }
@@ -96,6 +100,11 @@ int ObObj2strHelper::init_ob_charset_utils()
   return ret;
 }
 
+bool ObObj2strHelper::need_skip_obj2str(const common::ObObj &obj) const
+{
+  return enable_output_binary_column_batch_ && ObCDCColumnBatch::is_native_obj_type(obj.get_type());
+}
+
 void ObObj2strHelper::destroy()
 {
   inited_ = false;
@@ -104,6 +113,7 @@ void ObObj2strHelper::destroy()
   enable_hbase_mode_ = false;
   enable_convert_timestamp_to_unix_timestamp_ = false;
   enable_backup_mode_ = false;
+  enable_output_binary_column_batch_ = false;
   tenant_mgr_ = NULL;
 }
 
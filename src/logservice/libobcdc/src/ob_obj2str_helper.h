@@ -67,9 +67,16 @@ public:
       const bool enable_hbase_mode,
       const bool enable_convert_timestamp_to_unix_timestamp,
       const bool enable_backup_mode,
+      const bool enable_output_binary_column_batch,
       IObLogTenantMgr &tenant_mgr);
   void destroy();
 
+  bool is_output_binary_column_batch_enabled() const { return enable_output_binary_column_batch_; }
+  // Fixed-width column values of DML rows are exported by the column batch with native
+  // representation, their string conversion is skipped and a non-NULL empty string is
+  // output in binlog record. Only for column values, never for schema default values
+  bool need_skip_obj2str(const common::ObObj &obj) const;
+
 public:
   static const char *EMPTY_STRING;
 
@@ -127,6 +134,7 @@ private:
   bool                          enable_hbase_mode_;
   bool                          enable_convert_timestamp_to_unix_timestamp_;
   bool                          enable_backup_mode_;
+  bool                          enable_output_binary_column_batch_;
   IObLogTenantMgr               *tenant_mgr_;
 
 private:
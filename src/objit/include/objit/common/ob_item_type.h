@@ -492,6 +492,7 @@ typedef enum ObItemType
   T_FUN_SYS_ICU_VERSION = 765,
 
   T_FUN_SYS_CURRENT_USER_PRIV = 766,
+  T_FUN_APPROX_PERCENTILE = 767,
   ///< @note add new mysql only function type before this line
   T_MYSQL_ONLY_SYS_MAX_OP = 800,
 
@@ -2340,7 +2341,7 @@ extern const char *get_type_name(int type);
                          (op) == T_FUN_AGG_UDF || (op) == T_FUN_GROUPING_ID || \
                          (op) == T_FUN_JSON_ARRAYAGG || (op) == T_FUN_JSON_OBJECTAGG ||\
                          (op) == T_FUN_ORA_JSON_ARRAYAGG || (op) == T_FUN_ORA_JSON_OBJECTAGG ||\
-                         (op) == T_FUN_GROUP_ID || \
+                         (op) == T_FUN_GROUP_ID || (op) == T_FUN_APPROX_PERCENTILE || \
                          ((op) >= T_FUN_SYS_BIT_AND && (op) <= T_FUN_SYS_BIT_XOR))
 #define MAYBE_ROW_OP(op) ((op) >= T_OP_EQ && (op) <= T_OP_NE)
 #define IS_PSEUDO_COLUMN_TYPE(op) \
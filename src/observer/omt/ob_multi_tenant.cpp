@@ -2104,6 +2104,7 @@ void ObMultiTenant::run1()
         if (!OB_ISNULL(*it)) {
           ObTaskController::get().allow_next_syslog();
           LOG_INFO("dump tenant info", "tenant", **it);
+          (*it)->reset_queue_time();
         }
       }
     }
@@ -556,6 +556,63 @@ int64_t RpcStatInfo::to_string(char *buf, const int64_t len) const
   return pos;
 }
 
+void ObQueueTimeHistogram::reset()
+{
+  for (int64_t i = 0; i < N_SHARD; i++) {
+    for (int64_t j = 0; j < BUCKET_CNT; j++) {
+      ATOMIC_STORE(&shards_[i].cnt_[j], 0);
+    }
+  }
+}
+
+int64_t ObQueueTimeHistogram::sum_buckets(int64_t (&cnt)[BUCKET_CNT]) const
+{
+  int64_t total_cnt = 0;
+  for (int64_t j = 0; j < BUCKET_CNT; j++) {
+    cnt[j] = 0;
+    for (int64_t i = 0; i < N_SHARD; i++) {
+      cnt[j] += ATOMIC_LOAD(&shards_[i].cnt_[j]);
+    }
+    total_cnt += cnt[j];
+  }
+  return total_cnt;
+}
+
+int64_t ObQueueTimeHistogram::get_count() const
+{
+  int64_t cnt[BUCKET_CNT];
+  return sum_buckets(cnt);
+}
+
+int64_t ObQueueTimeHistogram::get_percentile(const double percentile) const
+{
+  int64_t queue_time = 0;
+  int64_t bucket_cnt[BUCKET_CNT];
+  const int64_t total_cnt = sum_buckets(bucket_cnt);
+  if (total_cnt > 0) {
+    const int64_t target_cnt = MAX(1, static_cast<int64_t>(std::ceil(total_cnt * percentile)));
+    int64_t cnt = 0;
+    int64_t idx = 0;
+    for (; idx < BUCKET_CNT - 1 && cnt + bucket_cnt[idx] < target_cnt; idx++) {
+      cnt += bucket_cnt[idx];
+    }
+    queue_time = 1L << idx;
+  }
+  return queue_time;
+}
+
+int64_t ObQueueTimeHistogram::to_string(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  J_OBJ_START();
+  J_KV("cnt", get_count(),
+       "p50", get_percentile(0.5),
+       "p90", get_percentile(0.9),
+       "p99", get_percentile(0.99),
+       "p999", get_percentile(0.999));
+  J_OBJ_END();
+  return pos;
+}
 
 ObTenant::ObTenant(const int64_t id,
                    const int64_t times_of_workers,
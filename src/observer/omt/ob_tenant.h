@@ -23,6 +23,7 @@
 #include "lib/lock/ob_mutex.h"
 #include "lib/atomic/ob_atomic.h"
 #include "lib/thread/ob_thread_name.h"
+#include "lib/thread_local/ob_tsi_utils.h"
 #include "lib/rc/ob_rc.h"
 #include "rpc/ob_request.h"
 #include "share/system_variable/ob_sys_var_class_type.h"
@@ -194,6 +195,36 @@ struct ObSqlThrottleMetrics
     K_(queue_time));
 };
 
+// Histogram of the time requests wait in the queues of a tenant, bucket i counts
+// the queue time in [2^(i-1), 2^i) us, so that the percentiles can be observed
+// with a handful of atomic counters. The counters are sharded by cpu, so that
+// workers on different cpus do not bounce one cache line, and summed when read.
+class ObQueueTimeHistogram
+{
+public:
+  static const int64_t BUCKET_CNT = 32;
+  static const int64_t N_SHARD = 32;
+  ObQueueTimeHistogram() { reset(); }
+  void add(const int64_t queue_time_us)
+  {
+    const int64_t idx = queue_time_us <= 0 ? 0 : 64 - __builtin_clzll(queue_time_us);
+    IGNORE_RETURN ATOMIC_FAA(&shards_[common::icpu_id() % N_SHARD].cnt_[MIN(idx, BUCKET_CNT - 1)], 1);
+  }
+  void reset();
+  int64_t get_count() const;
+  // upper bound of the queue time in us under which percentile of the requests are
+  int64_t get_percentile(const double percentile) const;
+  int64_t to_string(char *buf, const int64_t buf_len) const;
+private:
+  struct Shard
+  {
+    int64_t cnt_[BUCKET_CNT] CACHE_ALIGNED;
+  };
+  // sum of the shards, returns the total count
+  int64_t sum_buckets(int64_t (&cnt)[BUCKET_CNT]) const;
+  Shard shards_[N_SHARD];
+};
+
 // Forward declarations
 class ObThWorker;
 
@@ -432,6 +463,9 @@ public:
 
   OB_INLINE void add_idle_time(int64_t idle_time) { IGNORE_RETURN ATOMIC_FAA(reinterpret_cast<uint64_t *>(&idle_us_), idle_time); }
   OB_INLINE void add_worker_time(int64_t req_time) { IGNORE_RETURN ATOMIC_FAA(reinterpret_cast<uint64_t *>(&worker_us_), req_time); }
+  OB_INLINE void add_queue_time(int64_t queue_time) { queue_time_hist_.add(queue_time); }
+  // queue time of the requests since last reset, reset every time tenant info is dumped
+  OB_INLINE void reset_queue_time() { queue_time_hist_.reset(); }
   int rdlock(common::ObLDHandle &handle);
   int wrlock(common::ObLDHandle &handle);
   int try_rdlock(common::ObLDHandle &handle);
@@ -471,7 +505,8 @@ public:
                K_(recv_level_rpc_cnt),
                K_(group_map),
                K_(rpc_stat_info),
-               K_(token_change_ts))
+               K_(token_change_ts),
+               "queue_time", queue_time_hist_)
 public:
   static bool equal(const ObTenant *t1, const ObTenant *t2)
   {
@@ -616,6 +651,7 @@ public:
   // idle time between two checkpoints
   int64_t worker_us_ CACHE_ALIGNED;
   int64_t idle_us_ CACHE_ALIGNED;
+  ObQueueTimeHistogram queue_time_hist_ CACHE_ALIGNED;
 }; // end of class ObTenant
 
 OB_INLINE int64_t ObResourceGroup::min_worker_cnt() const
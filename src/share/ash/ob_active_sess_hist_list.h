@@ -13,6 +13,7 @@
 #ifndef _OB_SHARE_ASH_ACTIVE_SESSION_LIST_H_
 #define _OB_SHARE_ASH_ACTIVE_SESSION_LIST_H_
 
+#include "lib/atomic/ob_atomic.h"
 #include "lib/container/ob_array.h"
 #include "lib/lock/ob_tc_rwlock.h"
 #include "lib/ash/ob_active_session_guard.h"
@@ -43,14 +44,17 @@ public:
    * instead, regard it as an unlimited array goes to one direction forever
    * i.e. write_pos_ will increase for ever
    *
-   * Note: no concurrent access to list_
+   * Note: only the sampler writes list_, the slot is filled before write_pos_
+   * is published so that readers don't see the newest slot half written
    */
   void add(ActiveSessionStat &stat)
   {
     // TODO: optimize performance, eliminate '%'
-    int64_t idx = (write_pos_++ + list_.size()) % list_.size();
-    stat.id_ = write_pos_;
+    const int64_t pos = write_pos_;
+    int64_t idx = (pos + list_.size()) % list_.size();
+    stat.id_ = pos + 1;
     MEMCPY(&list_[idx], &stat, sizeof(ActiveSessionStat));
+    ATOMIC_STORE(&write_pos_, pos + 1);
     stat.wait_time_ = 0;
     if (list_[idx].event_no_) {
       stat.set_last_stat(&list_[idx]); // for wait event time fixup
@@ -58,7 +62,7 @@ public:
       stat.set_last_stat(nullptr); // for wait event time fixup
     }
   }
-  int64_t write_pos() const { return write_pos_; }
+  int64_t write_pos() const { return ATOMIC_LOAD(&write_pos_); }
   inline int64_t size() const { return list_.size(); }
   const ActiveSessionStat &get(int64_t pos) const {
     return list_[pos];
@@ -108,13 +112,14 @@ public:
   {
     int64_t read_start = 0;
     int64_t read_end = 0;
-    if (write_pos_ < list_.size()) {
+    const int64_t write_pos = this->write_pos();
+    if (write_pos < list_.size()) {
       // buffer not full
-      read_start = write_pos_ - 1;
+      read_start = write_pos - 1;
       read_end = 0;
     } else {
-      read_start = write_pos_ - 1;
-      read_end = write_pos_ - list_.size();
+      read_start = write_pos - 1;
+      read_end = write_pos - list_.size();
     }
     return Iterator(this, read_start, read_end);
   }
@@ -77,7 +77,9 @@ void ObActiveSessHistTask::runTimerTask()
 {
   if (OB_NOT_NULL(GCTX.session_mgr_)) {
     sample_time_ = ObTimeUtility::current_time();
-    GCTX.session_mgr_->for_each_session(*this);
+    // walk the per-cpu session shards rather than the session map, so sampling doesn't
+    // touch the reference count of every session under the feet of the request threads
+    GCTX.session_mgr_->for_each_session_in_shards(*this);
   }
 }
 
@@ -189,6 +189,27 @@ int ObLocationService::get(
   return ret;
 }
 
+int ObLocationService::batch_get(
+    const uint64_t tenant_id,
+    const ObIArray<ObTabletID> &tablet_ids,
+    const int64_t expire_renew_time,
+    ObIArray<ObLSID> &ls_ids)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", KR(ret));
+  } else if (OB_FAIL(tablet_ls_service_.batch_get(
+      tenant_id,
+      tablet_ids,
+      expire_renew_time,
+      ls_ids))) {
+    LOG_WARN("fail to batch get tablet to log stream",
+        KR(ret), K(tenant_id), K(tablet_ids), K(expire_renew_time));
+  }
+  return ret;
+}
+
 int ObLocationService::nonblock_get(
     const uint64_t tenant_id,
     const ObTabletID &tablet_id,
@@ -136,6 +136,18 @@ public:
       bool &is_cache_hit,
       ObLSID &ls_id);
 
+  // Gets the mappings between a batch of tablets and log streams synchronously.
+  // Tablets not hit in cache are renewed together with one inner sql per batch.
+  //
+  // @param [out] ls_ids: log streams of tablet_ids (same order)
+  // @return OB_MAPPING_BETWEEN_TABLET_AND_LS_NOT_EXIST if any tablet has no record in sys table.
+  //         OB_GET_LOCATION_TIME_OUT if get location by inner sql timeout.
+  int batch_get(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      const int64_t expire_renew_time,
+      common::ObIArray<ObLSID> &ls_ids);
+
   // Noblock way to get the mapping between the tablet and log stream.
   //
   // @return OB_MAPPING_BETWEEN_TABLET_AND_LS_NOT_EXIST if no records in sys table.
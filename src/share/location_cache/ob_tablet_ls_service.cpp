@@ -105,6 +105,81 @@ int ObTabletLSService::get(
   return ret;
 }
 
+int ObTabletLSService::batch_get(
+    const uint64_t tenant_id,
+    const ObIArray<ObTabletID> &tablet_ids,
+    const int64_t expire_renew_time,
+    ObIArray<ObLSID> &ls_ids)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObTabletID, 16> renew_tablet_ids;
+  ObSEArray<ObTabletLSCache, 16> tablet_caches;
+  ls_ids.reset();
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("service not init", KR(ret));
+  } else if (OB_UNLIKELY(OB_INVALID_TENANT_ID == tenant_id || tablet_ids.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(tenant_id), K(tablet_ids));
+  }
+  ObTabletLSCache tablet_cache;
+  for (int64_t i = 0; OB_SUCC(ret) && i < tablet_ids.count(); ++i) {
+    const ObTabletID &tablet_id = tablet_ids.at(i);
+    if (!is_valid_key_(tenant_id, tablet_id)) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("invalid key for tablet get", KR(ret), K(tenant_id), K(tablet_id));
+    } else if (is_sys_tenant(tenant_id) || tablet_id.is_sys_tablet()) {
+      EVENT_INC(LOCATION_CACHE_HIT);
+      ret = ls_ids.push_back(SYS_LS);
+    } else {
+      ret = get_from_cache_(tenant_id, tablet_id, tablet_cache);
+      if (OB_SUCCESS != ret && OB_CACHE_NOT_HIT != ret) {
+        LOG_WARN("get tablet location from cache failed", KR(ret), K(tenant_id), K(tablet_id));
+      } else if (OB_CACHE_NOT_HIT == ret
+          || tablet_cache.get_renew_time() <= expire_renew_time) {
+        // filled after renew
+        EVENT_INC(LOCATION_CACHE_MISS);
+        if (OB_FAIL(renew_tablet_ids.push_back(tablet_id))) {
+          LOG_WARN("push back failed", KR(ret), K(tablet_id));
+        } else {
+          ret = ls_ids.push_back(ObLSID());
+        }
+      } else {
+        EVENT_INC(LOCATION_CACHE_HIT);
+        ret = ls_ids.push_back(tablet_cache.get_ls_id());
+      }
+    }
+  }
+  if (OB_FAIL(ret) || renew_tablet_ids.empty()) {
+  } else if (OB_FAIL(batch_renew_cache_(tenant_id, renew_tablet_ids, tablet_caches))) {
+    LOG_WARN("batch renew tablet location failed", KR(ret), K(tenant_id), K(renew_tablet_ids));
+  } else {
+    typedef ObSEArray<ObTabletLSCache, 16>::iterator CacheIter;
+    CacheIter begin = tablet_caches.begin();
+    CacheIter end = tablet_caches.end();
+    std::sort(begin, end, [](const ObTabletLSCache &l, const ObTabletLSCache &r) {
+      return l.get_tablet_id() < r.get_tablet_id();
+    });
+    for (int64_t i = 0; OB_SUCC(ret) && i < ls_ids.count(); ++i) {
+      if (ls_ids.at(i).is_valid()) {
+      } else {
+        const ObTabletID &tablet_id = tablet_ids.at(i);
+        CacheIter cache = std::lower_bound(begin, end, tablet_id,
+            [](const ObTabletLSCache &l, const ObTabletID &r) {
+              return l.get_tablet_id() < r;
+            });
+        if (cache == end || cache->get_tablet_id() != tablet_id) {
+          ret = OB_MAPPING_BETWEEN_TABLET_AND_LS_NOT_EXIST;
+          LOG_TRACE("fail to get tablet by sql", KR(ret), K(tenant_id), K(tablet_id));
+        } else {
+          ls_ids.at(i) = cache->get_ls_id();
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTabletLSService::nonblock_get(
     const uint64_t tenant_id,
     const ObTabletID &tablet_id,
@@ -349,6 +424,50 @@ int ObTabletLSService::renew_cache_(
   return ret;
 }
 
+int ObTabletLSService::batch_renew_cache_(
+    const uint64_t tenant_id,
+    const ObIArray<ObTabletID> &tablet_ids,
+    ObIArray<ObTabletLSCache> &tablet_caches)
+{
+  int ret = OB_SUCCESS;
+  ObTimeoutCtx ctx;
+  tablet_caches.reset();
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("service not init", KR(ret));
+  } else if (OB_UNLIKELY(OB_INVALID_TENANT_ID == tenant_id || tablet_ids.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(tenant_id), K(tablet_ids));
+  } else if (OB_FAIL(set_timeout_ctx_(ctx))) {
+    LOG_WARN("failed to set timeout ctx", KR(ret));
+  } else {
+    int64_t start_idx = 0;
+    while (OB_SUCC(ret) && start_idx < tablet_ids.count()) {
+      const int64_t end_idx = MIN(start_idx + MAX_BATCH_RENEW_CNT, tablet_ids.count());
+      if (OB_FAIL(inner_batch_get_by_sql_(
+          tenant_id, tablet_ids, start_idx, end_idx, tablet_caches))) {
+        LOG_WARN("fail to batch get log stream info",
+            KR(ret), K(tenant_id), K(start_idx), K(end_idx));
+        if (ObLocationServiceUtility::treat_sql_as_timeout(ret)) {
+          ret = OB_GET_LOCATION_TIME_OUT;
+        }
+      } else {
+        start_idx = end_idx;
+      }
+    }
+    ARRAY_FOREACH(tablet_caches, i) {
+      if (OB_FAIL(update_cache_(tablet_caches.at(i)))) {
+        LOG_WARN("fail to update cache", KR(ret), K(tablet_caches.at(i)));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      FLOG_INFO("[TABLET_LOCATION]success to batch renew tablet cache", K(tenant_id),
+          "tablet_cnt", tablet_ids.count(), "renewed_cnt", tablet_caches.count());
+    }
+  }
+  return ret;
+}
+
 int ObTabletLSService::update_cache_(const ObTabletLSCache &tablet_cache)
 {
   int ret = OB_SUCCESS;
@@ -426,6 +545,81 @@ int ObTabletLSService::inner_get_by_sql_(
   return ret;
 }
 
+int ObTabletLSService::inner_batch_get_by_sql_(
+    const uint64_t tenant_id,
+    const ObIArray<ObTabletID> &tablet_ids,
+    const int64_t start_idx,
+    const int64_t end_idx,
+    ObIArray<ObTabletLSCache> &tablet_caches)
+{
+  int ret = OB_SUCCESS;
+  ObSqlString sql;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("service not init", KR(ret));
+  } else if (OB_ISNULL(sql_proxy_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sql proxy is null", KR(ret));
+  } else if (OB_UNLIKELY(OB_INVALID_TENANT_ID == tenant_id
+      || start_idx < 0
+      || start_idx >= end_idx
+      || end_idx > tablet_ids.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", KR(ret), K(tenant_id), K(start_idx), K(end_idx));
+  } else if (OB_FAIL(sql.assign_fmt(
+      "SELECT tablet_id, ls_id, ORA_ROWSCN from %s WHERE tablet_id IN (",
+      OB_ALL_TABLET_TO_LS_TNAME))) {
+    LOG_WARN("fail to assign sql", KR(ret));
+  }
+  for (int64_t idx = start_idx; OB_SUCC(ret) && idx < end_idx; ++idx) {
+    if (OB_FAIL(sql.append_fmt("%s%lu", start_idx == idx ? "" : ", ", tablet_ids.at(idx).id()))) {
+      LOG_WARN("fail to assign sql", KR(ret), K(idx));
+    }
+  }
+  if (FAILEDx(sql.append(")"))) {
+    LOG_WARN("fail to assign sql", KR(ret));
+  } else {
+    SMART_VAR(ObMySQLProxy::MySQLResult, res) {
+      sqlclient::ObMySQLResult *result = NULL;
+      ObTabletLSCache tablet_cache;
+      if (OB_FAIL(sql_proxy_->read(res, tenant_id, sql.ptr()))) {
+        LOG_WARN("fail to execute sql", KR(ret), K(tenant_id), K(sql));
+      } else if (OB_ISNULL(result = res.get_result())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("fail to get sql result", KR(ret));
+      }
+      const int64_t now = ObTimeUtility::current_time();
+      while (OB_SUCC(ret) && OB_SUCC(result->next())) {
+        int64_t int_tablet_id = ObTabletID::INVALID_TABLET_ID;
+        int64_t int_ls_id = ObLSID::INVALID_LS_ID;
+        int64_t row_scn = 0;
+        EXTRACT_INT_FIELD_MYSQL(*result, "tablet_id", int_tablet_id, int64_t);
+        EXTRACT_INT_FIELD_MYSQL(*result, "ls_id", int_ls_id, int64_t);
+        EXTRACT_INT_FIELD_MYSQL(*result, "ORA_ROWSCN", row_scn, int64_t);
+        tablet_cache.reset();
+        if (FAILEDx(tablet_cache.init(
+            tenant_id,
+            ObTabletID(int_tablet_id),
+            ObLSID(int_ls_id),
+            now,
+            row_scn))) {
+          LOG_WARN("init tablet_cache failed", KR(ret), K(tenant_id),
+              K(int_tablet_id), K(int_ls_id), K(now), K(row_scn));
+        } else if (OB_FAIL(tablet_caches.push_back(tablet_cache))) {
+          LOG_WARN("fail to push back", KR(ret), K(tablet_cache));
+        }
+      }
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+      } else if (OB_SUCC(ret)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("fail to get next row to the end", KR(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTabletLSService::set_timeout_ctx_(common::ObTimeoutCtx &ctx)
 {
   int ret = OB_SUCCESS;
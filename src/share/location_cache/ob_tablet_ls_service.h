@@ -53,6 +53,21 @@ public:
       const int64_t expire_renew_time,
       bool &is_cache_hit,
       ObLSID &ls_id);
+  // Gets the mappings between a batch of tablets and log streams synchronously.
+  // Tablets not hit in cache are renewed together with one inner sql for every
+  // MAX_BATCH_RENEW_CNT tablets.
+  //
+  // @param [in] tenant_id: target tenant which the tablets belong to
+  // @param [in] tablet_ids: target tablets
+  // @param [in] expire_renew_time: same as get()
+  // @param [out] ls_ids: log streams of tablet_ids (same order)
+  // @return OB_MAPPING_BETWEEN_TABLET_AND_LS_NOT_EXIST if any tablet has no record in sys table.
+  //         OB_GET_LOCATION_TIME_OUT if get location by inner sql timeout.
+  int batch_get(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      const int64_t expire_renew_time,
+      common::ObIArray<ObLSID> &ls_ids);
   // Noblock way to get the mapping between the tablet and log stream.
   //
   // @return OB_MAPPING_BETWEEN_TABLET_AND_LS_NOT_EXIST if no records in sys table.
@@ -86,16 +101,28 @@ private:
       const uint64_t tenant_id,
       const ObTabletID &tablet_id,
       ObTabletLSCache &tablet_cache);
+  // Renews tablet_ids and returns the renewed caches, tablets not in sys table are skipped.
+  int batch_renew_cache_(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      common::ObIArray<ObTabletLSCache> &tablet_caches);
   int update_cache_(const ObTabletLSCache &tablet_cache);
   int inner_get_by_sql_(
       const uint64_t tenant_id,
       const ObTabletID &tablet_id,
       ObTabletLSCache &tablet_cache);
+  int inner_batch_get_by_sql_(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObTabletID> &tablet_ids,
+      const int64_t start_idx,
+      const int64_t end_idx,
+      common::ObIArray<ObTabletLSCache> &tablet_caches);
   int set_timeout_ctx_(common::ObTimeoutCtx &ctx);
   bool is_valid_key_(const uint64_t tenant_id, const ObTabletID &tablet_id) const;
   const int64_t MINI_MODE_UPDATE_THREAD_CNT = 1;
   const int64_t USER_TASK_QUEUE_SIZE = 200 * 1000; // 20W partitions
   const int64_t MINI_MODE_USER_TASK_QUEUE_SIZE = 10 * 1000; // 1W partitions
+  const int64_t MAX_BATCH_RENEW_CNT = 200;
 
   bool inited_;
   bool stopped_;
@@ -334,6 +334,11 @@ DEF_INT(_rowsets_target_maxsize, OB_TENANT_PARAMETER, "524288", "[262144, 838860
 DEF_INT(_rowsets_max_rows, OB_TENANT_PARAMETER, "256", "[0, 65535]",
         "the row number processed by vectorized sql engine within one batch. Range: [0, 65535]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_merge_same_exprs, OB_TENANT_PARAMETER, "False",
+         "specifies whether structurally identical deterministic expressions of a plan share "
+         "one runtime expression, so that they are evaluated once per row or batch. "
+         "Value:  True:turned on;  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_STR_WITH_CHECKER(_ctx_memory_limit, OB_TENANT_PARAMETER, "",
         common::ObCtxMemoryLimitChecker,
         "specifies tenant ctx memory limit.",
@@ -399,6 +404,19 @@ DEF_BOOL(_sqlexec_disable_hash_based_distagg_tiv, OB_TENANT_PARAMETER, "False",
          "disable hash based distinct aggregation in the second stage of three stage aggregation for gby queries"
          "Value:  True:turned on  False: turned off",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_local_partial_aggregation, OB_TENANT_PARAMETER, "True",
+         "specifies whether a local hash group by with a large number of groups is preceded by an "
+         "adaptive partial hash group by. Value:  True:turned on;  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_fused_filter_kernel, OB_TENANT_PARAMETER, "False",
+         "specifies whether simple comparison filters over fixed-width types are evaluated by "
+         "fused kernels which write the skip bitmap directly in vectorized execution. "
+         "Value:  True:turned on;  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_approx_percentile_compression, OB_TENANT_PARAMETER, "100", "[10, 1000]",
+        "compression of the quantile sketch used by APPROX_PERCENTILE and APPROX_MEDIAN, "
+        "larger value gives better accuracy with more memory per group. Range: [10, 1000]",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_force_hash_groupby_dump, OB_TENANT_PARAMETER, "False",
          "force hash groupby to dump"
          "Value:  True:turned on  False: turned off",
@@ -682,6 +700,11 @@ DEF_INT(_tx_result_retention, OB_TENANT_PARAMETER, "300", "[0, 36000]",
         "The tx data can be recycled after at least _tx_result_retention seconds. "
         "Range: [0, 36000]",
         ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_lock_wait_handoff, OB_TENANT_PARAMETER, "False",
+         "specifies whether the requests waiting on a row are handed the row one by one in FIFO order "
+         "instead of all retrying when the lock holder ends. "
+         "Value:  True:turned on;  False: turned off",
+         ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_TIME(_ob_get_gts_ahead_interval, OB_CLUSTER_PARAMETER, "0s", "[0s, 1s]",
          "get gts ahead interval. Range: [0s, 1s]",
@@ -862,6 +885,10 @@ DEF_INT(builtin_db_data_verify_cycle, OB_CLUSTER_PARAMETER, "20", "[0, 360]",
         "The default value is 20. "
         "The real check cycle maybe longer than the specified value for insuring performance.",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_data_verify_io_bandwidth, OB_CLUSTER_PARAMETER, "64M", "[2M,)",
+        "max io bandwidth per second of background macro block verification. "
+        "Range: [2M, +∞). The default value is 64M",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_INT(micro_block_merge_verify_level, OB_CLUSTER_PARAMETER, "2", "[0,3]",
         "specify what kind of verification should be done when merging micro block. "
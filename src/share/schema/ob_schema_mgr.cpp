@@ -740,6 +740,7 @@ int ObSchemaMgr::assign(const ObSchemaMgr &other)
     }
     ASSIGN_FIELD(user_infos_);
     ASSIGN_FIELD(database_infos_);
+    // the name and id maps are copy-on-write, they share all nodes with %other here
     ASSIGN_FIELD(database_name_map_);
     ASSIGN_FIELD(tablegroup_infos_);
     ASSIGN_FIELD(table_infos_);
@@ -17,7 +17,7 @@
 #include "share/ob_define.h"
 #include "lib/container/ob_vector.h"
 #include "lib/allocator/page_arena.h"
-#include "lib/hash/ob_pointer_hashmap.h"
+#include "lib/hash/ob_cow_pointer_hashmap.h"
 #include "share/schema/ob_schema_struct.h"
 #include "share/schema/ob_table_schema.h"
 #include "share/schema/ob_priv_mgr.h"
@@ -487,16 +487,16 @@ typedef TableInfos::iterator TableIterator;
 typedef TableInfos::const_iterator ConstTableIterator;
 typedef DropTenantInfos::iterator DropTenantInfoIterator;
 typedef DropTenantInfos::const_iterator ConstDropTenantInfoIterator;
-typedef common::hash::ObPointerHashMap<ObDatabaseSchemaHashWrapper, ObSimpleDatabaseSchema *, GetTableKeyV2> DatabaseNameMap;
-typedef common::hash::ObPointerHashMap<uint64_t, ObSimpleTableSchemaV2 *, GetTableKeyV2> TableIdMap;
-typedef common::hash::ObPointerHashMap<uint64_t, ObSimpleDatabaseSchema *, GetTableKeyV2> DatabaseIdMap;
-typedef common::hash::ObPointerHashMap<ObTableSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> TableNameMap;
-typedef common::hash::ObPointerHashMap<ObIndexSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> IndexNameMap;
-typedef common::hash::ObPointerHashMap<ObAuxVPSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> AuxVPNameMap;
-typedef common::hash::ObPointerHashMap<ObAuxVPSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> LobMetaNameMap;
-typedef common::hash::ObPointerHashMap<ObAuxVPSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> LobPieceNameMap;
-typedef common::hash::ObPointerHashMap<ObForeignKeyInfoHashWrapper, ObSimpleForeignKeyInfo *, GetTableKeyV2> ForeignKeyNameMap;
-typedef common::hash::ObPointerHashMap<ObConstraintInfoHashWrapper, ObSimpleConstraintInfo *, GetTableKeyV2> ConstraintNameMap;
+typedef common::hash::ObCowPointerHashMap<ObDatabaseSchemaHashWrapper, ObSimpleDatabaseSchema *, GetTableKeyV2> DatabaseNameMap;
+typedef common::hash::ObCowPointerHashMap<uint64_t, ObSimpleTableSchemaV2 *, GetTableKeyV2> TableIdMap;
+typedef common::hash::ObCowPointerHashMap<uint64_t, ObSimpleDatabaseSchema *, GetTableKeyV2> DatabaseIdMap;
+typedef common::hash::ObCowPointerHashMap<ObTableSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> TableNameMap;
+typedef common::hash::ObCowPointerHashMap<ObIndexSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> IndexNameMap;
+typedef common::hash::ObCowPointerHashMap<ObAuxVPSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> AuxVPNameMap;
+typedef common::hash::ObCowPointerHashMap<ObAuxVPSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> LobMetaNameMap;
+typedef common::hash::ObCowPointerHashMap<ObAuxVPSchemaHashWrapper, ObSimpleTableSchemaV2 *, GetTableKeyV2> LobPieceNameMap;
+typedef common::hash::ObCowPointerHashMap<ObForeignKeyInfoHashWrapper, ObSimpleForeignKeyInfo *, GetTableKeyV2> ForeignKeyNameMap;
+typedef common::hash::ObCowPointerHashMap<ObConstraintInfoHashWrapper, ObSimpleConstraintInfo *, GetTableKeyV2> ConstraintNameMap;
 public:
   ObSchemaMgr();
   explicit ObSchemaMgr(common::ObIAllocator &allocator);
@@ -16,6 +16,7 @@
 #include "sql/code_generator/ob_static_engine_expr_cg.h"
 #include "sql/code_generator/ob_static_engine_cg.h"
 #include "sql/optimizer/ob_log_plan.h"
+#include "sql/optimizer/ob_log_group_by.h"
 #include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
@@ -63,10 +64,20 @@ int ObCodeGenerator::generate_exprs(const ObLogPlan &log_plan,
         exec_ctx->get_physical_plan_ctx()->get_original_param_cnt(),
         param_store_->count(),
         min_cluster_version_);
+    const ObSQLSessionInfo *session = log_plan.get_optimizer_context().get_session_info();
+    bool merge_same_exprs = false;
+    if (OB_NOT_NULL(session)) {
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session->get_effective_tenant_id()));
+      merge_same_exprs = tenant_config.is_valid() && tenant_config->_enable_merge_same_exprs;
+    }
     // init ctx for operator cg
     expr_cg.set_batch_size(phy_plan.get_batch_size());
-    if (OB_FAIL(expr_cg.generate(log_plan.get_optimizer_context().get_all_exprs(),
-                                 phy_plan.get_expr_frame_info()))) {
+    if (merge_same_exprs
+        && OB_FAIL(check_merge_same_exprs(log_plan.get_plan_root(), merge_same_exprs))) {
+      LOG_WARN("fail to check merge same exprs", K(ret));
+    } else if (FALSE_IT(expr_cg.set_merge_same_exprs(merge_same_exprs))) {
+    } else if (OB_FAIL(expr_cg.generate(log_plan.get_optimizer_context().get_all_exprs(),
+                                        phy_plan.get_expr_frame_info()))) {
       LOG_WARN("fail to generate expr", K(ret));
     } else {
       phy_plan.get_next_expr_id() = phy_plan.get_expr_frame_info().need_ctx_cnt_;
@@ -76,6 +87,25 @@ int ObCodeGenerator::generate_exprs(const ObLogPlan &log_plan,
   return ret;
 }
 
+int ObCodeGenerator::check_merge_same_exprs(ObLogicalOperator *op, bool &can_merge)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(op)) {
+    // do nothing
+  } else if (log_op_def::LOG_UNPIVOT == op->get_type()
+             || (log_op_def::LOG_GROUP_BY == op->get_type()
+                 && static_cast<ObLogGroupBy *>(op)->has_rollup())) {
+    can_merge = false;
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && can_merge && i < op->get_num_of_child(); i++) {
+      if (OB_FAIL(SMART_CALL(check_merge_same_exprs(op->get_child(i), can_merge)))) {
+        LOG_WARN("fail to check merge same exprs", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObCodeGenerator::generate_operators(const ObLogPlan &log_plan,
                                         ObPhysicalPlan &phy_plan,
                                         const uint64_t cur_cluster_version)
@@ -62,6 +62,11 @@ private:
                      ObPhysicalPlan &phy_plan,
                      const uint64_t cur_cluster_version);
 
+  // Rollup and unpivot overwrite their output exprs (e.g. rollup fills NULL to the group by
+  // exprs), exprs can not be merged in these plans.
+  // see ObStaticEngineExprCG::set_merge_same_exprs()
+  static int check_merge_same_exprs(ObLogicalOperator *op, bool &can_merge);
+
   //生成物理算子
   //@param [in]  log_plan 逻辑执行计划
   //@param [out] phy_plan 物理执行计划
@@ -850,7 +850,13 @@ int ObStaticEngineCG::generate_calc_exprs(
   int ret = OB_SUCCESS;
   ObSEArray<ObRawExpr *, 16> calc_raw_exprs;
   ObRawExprUniqueSet flattened_cur_op_exprs(true);
-  auto filter_func = [&](ObRawExpr *e) { return !has_exist_in_array(dep_exprs, e); };
+  // the same exprs of child output exprs are computed by child too, see
+  // ObStaticEngineExprCG::set_merge_same_exprs()
+  auto is_dep_expr = [&](ObRawExpr *e) {
+    return has_exist_in_array(dep_exprs, e)
+        || ObStaticEngineExprCG::has_same_rt_expr(dep_exprs, e);
+  };
+  auto filter_func = [&](ObRawExpr *e) { return !is_dep_expr(e); };
   if (OB_FAIL(ret)) {
     // do nothing
   } else if (OB_FAIL(flattened_cur_op_exprs.flatten_and_add_raw_exprs(
@@ -872,7 +878,7 @@ int ObStaticEngineCG::generate_calc_exprs(
           && !(raw_expr->is_column_ref_expr()
                && !need_flatten_gen_col)
           && !raw_expr->is_op_pseudo_column_expr()
-          && !has_exist_in_array(dep_exprs, flattened_cur_exprs_arr.at(i))
+          && !is_dep_expr(flattened_cur_exprs_arr.at(i))
           && (raw_expr->has_flag(CNT_VOLATILE_CONST)
               || contain_batch_stmt_parameter // 计算包含batch优化的折叠参数
               || !raw_expr->is_const_expr())) {
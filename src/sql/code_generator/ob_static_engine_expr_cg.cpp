@@ -19,6 +19,7 @@
 #include "sql/engine/expr/ob_expr_util.h"
 #include "sql/engine/expr/ob_expr_extra_info_factory.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/rewrite/ob_transform_utils.h"
 
 namespace oceanbase
 {
@@ -57,6 +58,9 @@ int ObStaticEngineExprCG::generate(const ObRawExprUniqueSet &all_raw_exprs,
 {
   int ret = OB_SUCCESS;
   ObRawExprUniqueSet flattened_raw_exprs(true);
+  ObSEArray<ObRawExpr *, 64> unique_exprs;
+  ObSEArray<ObRawExpr *, 16> same_exprs;
+  ObSEArray<ObRawExpr *, 16> same_targets;
   if (all_raw_exprs.count() <= 0) {
     // do nothing
   } else if (OB_FAIL(flattened_raw_exprs.flatten_and_add_raw_exprs(all_raw_exprs))) {
@@ -64,15 +68,264 @@ int ObStaticEngineExprCG::generate(const ObRawExprUniqueSet &all_raw_exprs,
   } else if (OB_FAIL(divide_probably_local_exprs(
                      const_cast<ObIArray<ObRawExpr *> &>(flattened_raw_exprs.get_expr_array())))) {
     LOG_WARN("divided probably local exprs failed", K(ret));
-  } else if (OB_FAIL(construct_exprs(flattened_raw_exprs.get_expr_array(),
-                                     expr_info.rt_exprs_))) {
-    LOG_WARN("failed to construct rt exprs", K(ret));
-  } else if (OB_FAIL(cg_exprs(flattened_raw_exprs.get_expr_array(), expr_info))) {
-    LOG_WARN("failed to cg exprs", K(ret));
+  } else if (merge_same_exprs_
+             && OB_FAIL(merge_same_exprs(flattened_raw_exprs.get_expr_array(),
+                                         unique_exprs, same_exprs, same_targets))) {
+    LOG_WARN("failed to merge same exprs", K(ret));
+  } else {
+    const ObIArray<ObRawExpr *> &raw_exprs = merge_same_exprs_
+        ? static_cast<const ObIArray<ObRawExpr *> &>(unique_exprs)
+        : flattened_raw_exprs.get_expr_array();
+    if (OB_FAIL(construct_exprs(raw_exprs, expr_info.rt_exprs_))) {
+      LOG_WARN("failed to construct rt exprs", K(ret));
+    } else {
+      for (int64_t i = 0; i < same_exprs.count(); i++) {
+        same_exprs.at(i)->set_rt_expr(get_rt_expr(*same_targets.at(i)));
+      }
+      if (OB_FAIL(cg_exprs(raw_exprs, expr_info))) {
+        LOG_WARN("failed to cg exprs", K(ret));
+      }
+    }
   }
   return ret;
 }
 
+// Exprs which are structurally identical and deterministic are mapped to the first one of
+// them, only the first one constructs rt expr, e.g.:
+//   filter of scan: c1 + 1 > 10, output of sort: c1 + 1 (copied by transformer)
+//   ==> both c1 + 1 use the same ObExpr (frame slot and evaluated flags)
+// The params of the same exprs must be mapped to the same rt expr too.
+int ObStaticEngineExprCG::merge_same_exprs(const ObIArray<ObRawExpr *> &raw_exprs,
+                                           ObIArray<ObRawExpr *> &unique_exprs,
+                                           ObIArray<ObRawExpr *> &same_exprs,
+                                           ObIArray<ObRawExpr *> &same_targets)
+{
+  int ret = OB_SUCCESS;
+  SameExprMap same_map;
+  SameExprHashMap hash_map;
+  ObSEArray<SameExprEntry, 64> entries;
+  const int64_t bucket_num = MAX(raw_exprs.count(), 16);
+  if (OB_FAIL(same_map.create(bucket_num, "SameExprMap", "SameExprMap"))) {
+    LOG_WARN("failed to create hash map", K(ret), K(bucket_num));
+  } else if (OB_FAIL(hash_map.create(bucket_num, "SameExprMap", "SameExprMap"))) {
+    LOG_WARN("failed to create hash map", K(ret), K(bucket_num));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < raw_exprs.count(); i++) {
+    ObRawExpr *expr = raw_exprs.at(i);
+    ObRawExpr *same_expr = NULL;
+    if (OB_FAIL(find_same_expr(expr, same_map, hash_map, entries, same_expr))) {
+      LOG_WARN("failed to find same expr", K(ret), KPC(expr));
+    } else if (same_expr == expr) {
+      if (OB_FAIL(unique_exprs.push_back(expr))) {
+        LOG_WARN("failed to push back expr", K(ret));
+      }
+    } else if (OB_FAIL(same_exprs.push_back(expr))) {
+      LOG_WARN("failed to push back expr", K(ret));
+    } else if (OB_FAIL(same_targets.push_back(same_expr))) {
+      LOG_WARN("failed to push back expr", K(ret));
+    }
+  }
+  if (OB_SUCC(ret) && !same_exprs.empty()) {
+    LOG_TRACE("merge same exprs", K(raw_exprs.count()), K(same_exprs.count()));
+  }
+  return ret;
+}
+
+int ObStaticEngineExprCG::find_same_expr(ObRawExpr *expr,
+                                         SameExprMap &same_map,
+                                         SameExprHashMap &hash_map,
+                                         ObIArray<SameExprEntry> &entries,
+                                         ObRawExpr *&same_expr)
+{
+  int ret = OB_SUCCESS;
+  bool is_stack_overflow = false;
+  bool can_merge = false;
+  same_expr = NULL;
+  if (OB_ISNULL(expr)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("expr is null", K(ret));
+  } else if (OB_FAIL(check_stack_overflow(is_stack_overflow))) {
+    LOG_WARN("failed to check stack overflow", K(ret));
+  } else if (is_stack_overflow) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("too deep recursive", K(ret));
+  } else if (OB_FAIL(same_map.get_refactored(reinterpret_cast<uint64_t>(expr), same_expr))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      ret = OB_SUCCESS;
+      same_expr = NULL;
+    } else {
+      LOG_WARN("failed to get from hash map", K(ret));
+    }
+  }
+  if (OB_FAIL(ret) || NULL != same_expr) {
+  } else if (OB_FAIL(can_merge_same_expr(*expr, can_merge))) {
+    LOG_WARN("failed to check can merge same expr", K(ret));
+  } else if (!can_merge) {
+    same_expr = expr;
+  } else {
+    ObSEArray<ObRawExpr *, 4> same_params;
+    uint64_t hash_code = common::do_hash(expr->get_expr_type(), 0);
+    hash_code = expr->get_result_type().hash(hash_code);
+    for (int64_t i = 0; OB_SUCC(ret) && i < expr->get_param_count(); i++) {
+      ObRawExpr *same_param = NULL;
+      if (OB_FAIL(SMART_CALL(find_same_expr(expr->get_param_expr(i), same_map, hash_map,
+                                            entries, same_param)))) {
+        LOG_WARN("failed to find same expr", K(ret));
+      } else if (OB_FAIL(same_params.push_back(same_param))) {
+        LOG_WARN("failed to push back expr", K(ret));
+      } else {
+        hash_code = common::do_hash(reinterpret_cast<uint64_t>(same_param), hash_code);
+      }
+    }
+    int64_t idx = -1;
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(hash_map.get_refactored(hash_code, idx))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        ret = OB_SUCCESS;
+        idx = -1;
+      } else {
+        LOG_WARN("failed to get from hash map", K(ret));
+      }
+    }
+    for (int64_t i = idx; OB_SUCC(ret) && NULL == same_expr && i >= 0; i = entries.at(i).next_) {
+      ObRawExpr *cand = entries.at(i).expr_;
+      bool is_same = cand->get_param_count() == expr->get_param_count()
+          && is_same_cg_attrs(*cand, *expr);
+      // params of %cand are already in %same_map
+      for (int64_t j = 0; OB_SUCC(ret) && is_same && j < cand->get_param_count(); j++) {
+        ObRawExpr *same_param = NULL;
+        if (OB_FAIL(same_map.get_refactored(reinterpret_cast<uint64_t>(cand->get_param_expr(j)),
+                                            same_param))) {
+          LOG_WARN("failed to get from hash map", K(ret));
+        } else {
+          is_same = same_param == same_params.at(j);
+        }
+      }
+      if (OB_SUCC(ret) && is_same && expr->same_as(*cand)) {
+        same_expr = cand;
+      }
+    }
+    if (OB_SUCC(ret) && NULL == same_expr) {
+      same_expr = expr;
+      if (OB_FAIL(entries.push_back(SameExprEntry(expr, idx)))) {
+        LOG_WARN("failed to push back entry", K(ret));
+      } else if (OB_FAIL(hash_map.set_refactored(hash_code, entries.count() - 1,
+                                                 1 /* overwrite */))) {
+        LOG_WARN("failed to set hash map", K(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret)
+      && OB_FAIL(same_map.set_refactored(reinterpret_cast<uint64_t>(expr), same_expr,
+                                         1 /* overwrite */))) {
+    LOG_WARN("failed to set hash map", K(ret));
+  }
+  return ret;
+}
+
+// Exprs can be merged:
+// 1. deterministic operator or system function with column, without the exprs produced or
+//    assigned by operators (aggregation, exec param, pseudo column ...)
+// 2. null propagate: outer join fill NULL to the output exprs of the null side, the merged
+//    expr computed above the join must get the same NULL result.
+// 3. not the subclasses of ObOpRawExpr / ObSysFunRawExpr, which carry more attributes for cg
+int ObStaticEngineExprCG::can_merge_same_expr(const ObRawExpr &expr, bool &can_merge)
+{
+  int ret = OB_SUCCESS;
+  static const ObItemType disable_types[] = {
+    T_OP_ROW, T_OBJ_ACCESS_REF, T_FUN_PL_ASSOCIATIVE_INDEX, T_SP_CPARAM, T_FUN_PL_INTEGER_CHECKER,
+    T_OP_MULTISET, T_OP_COLL_PRED, T_FUN_SYS_SEQ_NEXTVAL, T_FUN_NORMAL_UDF,
+    T_FUN_PL_COLLECTION_CONSTRUCT, T_FUN_PL_OBJECT_CONSTRUCT, T_FUN_PL_GET_CURSOR_ATTR,
+    T_FUN_PL_SQLCODE_SQLERRM, T_FUN_PLSQL_VARIABLE
+  };
+  static const ObExprInfoFlag disable_flags[] = {
+    CNT_AGG, CNT_SUB_QUERY, CNT_ONETIME, CNT_VALUES, CNT_DEFAULT, CNT_USER_VARIABLE,
+    CNT_STATE_FUNC, CNT_SET_OP, CNT_LAST_INSERT_ID, CNT_WINDOW_FUNC, CNT_PRIOR, CNT_RAND_FUNC,
+    CNT_ROWNUM, CNT_LEVEL, CNT_CONNECT_BY_ISLEAF, CNT_CONNECT_BY_ISCYCLE, CNT_PSEUDO_COLUMN,
+    CNT_CONNECT_BY_ROOT, CNT_SYS_CONNECT_BY_PATH, CNT_SO_UDF, CNT_PL_UDF, CNT_SEQ_EXPR,
+    CNT_DYNAMIC_PARAM, CNT_VOLATILE_CONST, CNT_ORA_ROWSCN_EXPR, CNT_OP_PSEUDO_COLUMN,
+    CNT_ASSIGN_EXPR
+  };
+  can_merge = (expr.is_op_expr() || expr.is_sys_func_expr())
+      && expr.is_deterministic()
+      && expr.has_flag(CNT_COLUMN)
+      && !expr.is_const_expr();
+  for (int64_t i = 0; can_merge && i < ARRAYSIZEOF(disable_types); i++) {
+    can_merge = disable_types[i] != expr.get_expr_type();
+  }
+  for (int64_t i = 0; can_merge && i < ARRAYSIZEOF(disable_flags); i++) {
+    can_merge = !expr.has_flag(disable_flags[i]);
+  }
+  if (can_merge) {
+    ObSEArray<ObRawExpr *, 4> column_exprs;
+    if (OB_FAIL(ObRawExprUtils::extract_column_exprs(&expr, column_exprs))) {
+      LOG_WARN("failed to extract column exprs", K(ret));
+    } else if (OB_FAIL(ObTransformUtils::is_null_propagate_expr(&expr, column_exprs,
+                                                                can_merge))) {
+      LOG_WARN("failed to check null propagate expr", K(ret));
+    }
+  }
+  return ret;
+}
+
+// Everything cg reads from the raw expr other than the params must be the same:
+// the basic attributes in cg_expr_basic(), extra_ (e.g. cast mode) and input types read by
+// ObExprOperator::cg_expr(), and the whole result type (calc type, result flags ...).
+bool ObStaticEngineExprCG::is_same_cg_attrs(ObRawExpr &l, ObRawExpr &r)
+{
+  const ObExprResType &l_type = l.get_result_type();
+  const ObExprResType &r_type = r.get_result_type();
+  bool is_same = l.get_expr_type() == r.get_expr_type()
+      && l.get_expr_class() == r.get_expr_class()
+      && l.get_extra() == r.get_extra()
+      && l.is_called_in_sql() == r.is_called_in_sql()
+      && l.is_vectorize_result() == r.is_vectorize_result()
+      && l.is_bool_expr() == r.is_bool_expr()
+      && l.has_flag(IS_PROBABLY_LOCAL) == r.has_flag(IS_PROBABLY_LOCAL)
+      && l.has_flag(IS_TABLE_ASSIGN) == r.has_flag(IS_TABLE_ASSIGN)
+      && l_type == r_type
+      && l_type.get_calc_meta() == r_type.get_calc_meta()
+      && l_type.get_calc_accuracy() == r_type.get_calc_accuracy()
+      && l_type.get_result_flag() == r_type.get_result_flag()
+      && l_type.get_param().get_meta() == r_type.get_param().get_meta()
+      && l_type.get_param().is_equal(r_type.get_param(), CS_TYPE_BINARY)
+      && l_type.get_row_calc_cmp_types().count() == r_type.get_row_calc_cmp_types().count();
+  for (int64_t i = 0; is_same && i < l_type.get_row_calc_cmp_types().count(); i++) {
+    is_same = l_type.get_row_calc_cmp_types().at(i) == r_type.get_row_calc_cmp_types().at(i);
+  }
+  if (is_same) {
+    // both are ObOpRawExpr, see can_merge_same_expr()
+    ObOpRawExpr &l_op = static_cast<ObOpRawExpr &>(l);
+    ObOpRawExpr &r_op = static_cast<ObOpRawExpr &>(r);
+    const ObExprResTypes &l_inputs = l_op.get_input_types();
+    const ObExprResTypes &r_inputs = r_op.get_input_types();
+    is_same = l_inputs.count() == r_inputs.count()
+        && l_op.get_subquery_key() == r_op.get_subquery_key();
+    for (int64_t i = 0; is_same && i < l_inputs.count(); i++) {
+      is_same = l_inputs.at(i) == r_inputs.at(i)
+          && l_inputs.at(i).get_calc_meta() == r_inputs.at(i).get_calc_meta()
+          && l_inputs.at(i).get_calc_accuracy() == r_inputs.at(i).get_calc_accuracy()
+          && l_inputs.at(i).get_result_flag() == r_inputs.at(i).get_result_flag();
+    }
+    if (is_same && l.is_sys_func_expr()) {
+      is_same = static_cast<ObSysFunRawExpr &>(l).get_op_id()
+          == static_cast<ObSysFunRawExpr &>(r).get_op_id();
+    }
+  }
+  return is_same;
+}
+
+bool ObStaticEngineExprCG::has_same_rt_expr(const ObIArray<ObRawExpr *> &exprs,
+                                            const ObRawExpr *expr)
+{
+  bool found = false;
+  const ObExpr *rt_expr = NULL == expr ? NULL : get_rt_expr(*expr);
+  for (int64_t i = 0; NULL != rt_expr && !found && i < exprs.count(); i++) {
+    found = NULL != exprs.at(i) && get_rt_expr(*exprs.at(i)) == rt_expr;
+  }
+  return found;
+}
+
 // used for temp expr generate
 int ObStaticEngineExprCG::generate(ObRawExpr *expr,
                                    ObRawExprUniqueSet &flattened_raw_exprs,
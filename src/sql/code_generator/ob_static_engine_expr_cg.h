@@ -15,6 +15,7 @@
 
 #include "sql/engine/expr/ob_expr.h"
 #include "sql/engine/expr/ob_expr_frame_info.h"
+#include "lib/hash/ob_hashmap.h"
 #include "share/ob_cluster_version.h"
 
 namespace oceanbase
@@ -103,7 +104,8 @@ public:
       batch_size_(0),
       rt_question_mark_eval_(false),
       need_flatten_gen_col_(true),
-      cur_cluster_version_(cur_cluster_version)
+      cur_cluster_version_(cur_cluster_version),
+      merge_same_exprs_(false)
   {
   }
   virtual ~ObStaticEngineExprCG() {}
@@ -159,6 +161,15 @@ public:
 
   void set_need_flatten_gen_col(const bool v) { need_flatten_gen_col_ = v; }
 
+  // Map structurally identical deterministic exprs to one rt expr in generate(), they share
+  // the frame slot and evaluated flags, so the value is computed once per row/batch.
+  void set_merge_same_exprs(const bool v) { merge_same_exprs_ = v; }
+
+  // Whether %expr is the same rt expr of one of %exprs (the raw exprs may be different
+  // if they are merged by set_merge_same_exprs()).
+  static bool has_same_rt_expr(const common::ObIArray<ObRawExpr *> &exprs,
+                               const ObRawExpr *expr);
+
   static int gen_expr_with_row_desc(const ObRawExpr *expr,
                                     const RowDesc &row_desc,
                                     ObIAllocator &alloctor,
@@ -392,6 +403,38 @@ private:
 
   int divide_probably_local_exprs(common::ObIArray<ObRawExpr *> &exprs);
 
+  struct SameExprEntry
+  {
+    SameExprEntry() : expr_(NULL), next_(-1) {}
+    SameExprEntry(ObRawExpr *expr, const int64_t next) : expr_(expr), next_(next) {}
+    TO_STRING_KV(KP_(expr), K_(next));
+    ObRawExpr *expr_;
+    int64_t next_; // next entry with the same hash code
+  };
+  // raw expr => the first same raw expr (itself if no same expr found)
+  typedef common::hash::ObHashMap<uint64_t, ObRawExpr *,
+                                  common::hash::NoPthreadDefendMode> SameExprMap;
+  // hash code => index of the first entry in entries
+  typedef common::hash::ObHashMap<uint64_t, int64_t,
+                                  common::hash::NoPthreadDefendMode> SameExprHashMap;
+
+  // Split %raw_exprs into exprs need to construct rt expr and the same exprs of them.
+  // @param [in] raw_exprs flattened raw exprs
+  // @param [out] unique_exprs exprs need to construct rt expr, in order of %raw_exprs
+  // @param [out] same_exprs exprs use the rt expr of same_targets at the same index
+  // @param [out] same_targets
+  int merge_same_exprs(const common::ObIArray<ObRawExpr *> &raw_exprs,
+                       common::ObIArray<ObRawExpr *> &unique_exprs,
+                       common::ObIArray<ObRawExpr *> &same_exprs,
+                       common::ObIArray<ObRawExpr *> &same_targets);
+  int find_same_expr(ObRawExpr *expr,
+                     SameExprMap &same_map,
+                     SameExprHashMap &hash_map,
+                     common::ObIArray<SameExprEntry> &entries,
+                     ObRawExpr *&same_expr);
+  static int can_merge_same_expr(const ObRawExpr &expr, bool &can_merge);
+  static bool is_same_cg_attrs(ObRawExpr &l, ObRawExpr &r);
+
 private:
   // disallow copy
   DISALLOW_COPY_AND_ASSIGN(ObStaticEngineExprCG);
@@ -419,6 +462,8 @@ private:
   //is code generate temp expr witch used in table location
   bool need_flatten_gen_col_;
   uint64_t cur_cluster_version_;
+  // map same exprs to one rt expr in generate()
+  bool merge_same_exprs_;
 };
 
 } // end namespace sql
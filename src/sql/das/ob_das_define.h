@@ -58,6 +58,12 @@ const int64_t OB_DAS_MAX_PACKET_SIZE = 2 * 1024 * 1024l - 8 * 1024;
  * so OB_DAS_MAX_TOTAL_PACKET_SIZE was defined as:
  */
 const int64_t OB_DAS_MAX_TOTAL_PACKET_SIZE = 3 * OB_DAS_MAX_PACKET_SIZE;
+/**
+ * The remaining result of a remote das scan is fetched in chunks, the chunk size starts
+ * from OB_DAS_MAX_PACKET_SIZE and doubles with every fetch up to OB_DAS_MAX_FETCH_SIZE,
+ * so that a large result needs a few fetch round trips only.
+ */
+const int64_t OB_DAS_MAX_FETCH_SIZE = 8 * OB_DAS_MAX_PACKET_SIZE;
 }  // namespace das
 
 enum class ObDasTaskStatus: uint8_t
@@ -26,7 +26,8 @@ ObDASExtraData::ObDASExtraData()
     result_(),
     result_iter_(),
     has_more_(false),
-    need_check_output_datum_(false)
+    need_check_output_datum_(false),
+    fetch_size_(das::OB_DAS_MAX_PACKET_SIZE)
 {
 }
 
@@ -44,6 +45,7 @@ int ObDASExtraData::init(const int64_t task_id,
     result_addr_ = result_addr;
     has_more_ = false;
     need_check_output_datum_ = false;
+    fetch_size_ = das::OB_DAS_MAX_PACKET_SIZE;
   }
   return ret;
 }
@@ -60,7 +62,7 @@ int ObDASExtraData::fetch_result()
   if (OB_UNLIKELY(timeout <= 0)) {
     ret = OB_TIMEOUT;
     LOG_WARN("das extra data fetch result timeout", KR(ret), K(timeout_ts_), K(timeout));
-  } else if (OB_FAIL(req.init(tenant_id, task_id_))) {
+  } else if (OB_FAIL(req.init(tenant_id, task_id_, fetch_size_))) {
     LOG_WARN("init das data fetch request failed", KR(ret));
   } else if (OB_FAIL(rpc_proxy_
                      .to(result_addr_)
@@ -73,6 +75,9 @@ int ObDASExtraData::fetch_result()
   } else {
     LOG_TRACE("das fetch task result", KR(ret), K(req), K(result_));
     has_more_ = result_.has_more();
+    if (has_more_) {
+      fetch_size_ = MIN(fetch_size_ * 2, das::OB_DAS_MAX_FETCH_SIZE);
+    }
   }
   NG_TRACE(fetch_das_extra_result_end);
   return ret;
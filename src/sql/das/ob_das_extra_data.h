@@ -51,6 +51,8 @@ private:
   ObChunkDatumStore::Iterator result_iter_;
   bool has_more_;
   bool need_check_output_datum_;
+  // result size requested by the next fetch, grows while the remote result has more
+  int64_t fetch_size_;
 };
 }  // namespace sql
 }  // namespace oceanbase
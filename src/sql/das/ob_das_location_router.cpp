@@ -709,6 +709,66 @@ int ObDASLocationRouter::get(const ObDASTableLocMeta &loc_meta,
   return ret;
 }
 
+int ObDASLocationRouter::batch_get(const ObDASTableLocMeta &loc_meta,
+                                   const ObIArray<ObTabletID> &tablet_ids,
+                                   ObIArray<ObLSLocation> &locations)
+{
+  int ret = OB_SUCCESS;
+  uint64_t tenant_id = MTL_ID();
+  bool is_vt = is_virtual_table(loc_meta.ref_table_id_);
+  bool is_mapping_real_vt = is_oracle_mapping_real_virtual_table(loc_meta.ref_table_id_);
+  locations.reset();
+  if (OB_UNLIKELY(is_vt || is_mapping_real_vt || tablet_ids.count() <= 1)) {
+    ObLSLocation location;
+    for (int64_t i = 0; OB_SUCC(ret) && i < tablet_ids.count(); ++i) {
+      location.reset();
+      if (OB_FAIL(get(loc_meta, tablet_ids.at(i), location))) {
+        LOG_WARN("get ls location failed", K(ret), K(loc_meta), K(tablet_ids.at(i)));
+      } else if (OB_FAIL(locations.push_back(location))) {
+        LOG_WARN("store ls location failed", K(ret));
+      }
+    }
+  } else {
+    int64_t expire_renew_time = 2 * 1000000; // 2s
+    bool is_cache_hit = false;
+    ObSEArray<ObLSID, 16> ls_ids;
+    if (OB_FAIL(GCTX.location_service_->batch_get(tenant_id,
+                                                  tablet_ids,
+                                                  expire_renew_time,
+                                                  ls_ids))) {
+      LOG_WARN("batch get ls ids failed", K(ret), K(tenant_id), K(tablet_ids));
+    } else if (OB_FAIL(locations.prepare_allocate(tablet_ids.count()))) {
+      LOG_WARN("prepare allocate locations failed", K(ret));
+    }
+    // tablets of a table usually share a few log streams, index of the first
+    // tablet of every fetched log stream is kept to reuse its location
+    ObSEArray<int64_t, 8> fetched_idxs;
+    for (int64_t i = 0; OB_SUCC(ret) && i < ls_ids.count(); ++i) {
+      int64_t fetched_idx = OB_INVALID_INDEX;
+      for (int64_t j = 0; OB_INVALID_INDEX == fetched_idx && j < fetched_idxs.count(); ++j) {
+        if (ls_ids.at(fetched_idxs.at(j)) == ls_ids.at(i)) {
+          fetched_idx = fetched_idxs.at(j);
+        }
+      }
+      if (OB_INVALID_INDEX != fetched_idx) {
+        if (OB_FAIL(locations.at(i).assign(locations.at(fetched_idx)))) {
+          LOG_WARN("assign ls location failed", K(ret), K(ls_ids.at(i)));
+        }
+      } else if (OB_FAIL(GCTX.location_service_->get(GCONF.cluster_id,
+                                                     tenant_id,
+                                                     ls_ids.at(i),
+                                                     expire_renew_time,
+                                                     is_cache_hit,
+                                                     locations.at(i)))) {
+        LOG_WARN("fail to get ls location", K(ret), K(tenant_id), K(ls_ids.at(i)));
+      } else if (OB_FAIL(fetched_idxs.push_back(i))) {
+        LOG_WARN("store fetched index failed", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDASLocationRouter::get_tablet_loc(const ObDASTableLocMeta &loc_meta,
                                         const ObTabletID &tablet_id,
                                         ObDASTabletLoc &tablet_loc)
@@ -234,6 +234,11 @@ public:
   int get(const ObDASTableLocMeta &loc_meta,
           const common::ObTabletID &tablet_id,
           share::ObLSLocation &location);
+  // same as get(), but resolves the log streams of all tablets in one batch and
+  // fetches the location of each distinct log stream only once
+  int batch_get(const ObDASTableLocMeta &loc_meta,
+                const common::ObIArray<common::ObTabletID> &tablet_ids,
+                common::ObIArray<share::ObLSLocation> &locations);
 
   int get_tablet_loc(const ObDASTableLocMeta &loc_meta,
                      const common::ObTabletID &tablet_id,
@@ -276,6 +276,9 @@ int ObDASSyncFetchP::process()
   ObDataAccessService *das = NULL;
   const uint64_t tenant_id = req.get_tenant_id();
   const int64_t task_id = req.get_task_id();
+  // the requester of an old version doesn't send fetch size
+  const int64_t fetch_size = MIN(MAX(req.get_fetch_size(), das::OB_DAS_MAX_PACKET_SIZE),
+                                 das::OB_DAS_MAX_FETCH_SIZE);
   ObChunkDatumStore &datum_store = res.get_datum_store();
   bool has_more = false;
   if (tenant_id != MTL_ID()) {
@@ -288,7 +291,8 @@ int ObDASSyncFetchP::process()
     LOG_WARN("das is null", KR(ret), KP(das));
   } else if (OB_FAIL(das->get_task_res_mgr().iterator_task_result(task_id,
                                                                   datum_store,
-                                                                  has_more))) {
+                                                                  has_more,
+                                                                  fetch_size))) {
     if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST == ret)) {
       // After server reboot, the hash map containing task results was gone.
       // We need to retry for such cases.
@@ -467,12 +467,15 @@ int ObDASTaskResp::add_op_result(ObIDASTaskResult *op_result)
 
 OB_SERIALIZE_MEMBER(ObIDASTaskResult, task_id_);
 
-OB_SERIALIZE_MEMBER(ObDASDataFetchReq, tenant_id_, task_id_);
+OB_SERIALIZE_MEMBER(ObDASDataFetchReq, tenant_id_, task_id_, fetch_size_);
 
-int ObDASDataFetchReq::init(const uint64_t tenant_id, const int64_t task_id)
+int ObDASDataFetchReq::init(const uint64_t tenant_id,
+                            const int64_t task_id,
+                            const int64_t fetch_size)
 {
   tenant_id_ = tenant_id;
   task_id_ = task_id;
+  fetch_size_ = fetch_size;
   return OB_SUCCESS;
 }
 
@@ -483,16 +483,21 @@ class ObDASDataFetchReq
 {
   OB_UNIS_VERSION(1);
 public:
-  ObDASDataFetchReq() : tenant_id_(0), task_id_(0) {}
+  ObDASDataFetchReq()
+    : tenant_id_(0), task_id_(0), fetch_size_(das::OB_DAS_MAX_PACKET_SIZE) {}
   ~ObDASDataFetchReq() {}
-  int init(const uint64_t tenant_id, const int64_t task_id);
+  int init(const uint64_t tenant_id, const int64_t task_id,
+           const int64_t fetch_size = das::OB_DAS_MAX_PACKET_SIZE);
 public:
   uint64_t get_tenant_id() { return tenant_id_; }
   int64_t get_task_id() { return task_id_; }
-  TO_STRING_KV(K_(tenant_id), K_(task_id));
+  int64_t get_fetch_size() { return fetch_size_; }
+  TO_STRING_KV(K_(tenant_id), K_(task_id), K_(fetch_size));
 private:
   uint64_t tenant_id_;
   int64_t task_id_;
+  // max result size the requester accepts in one response
+  int64_t fetch_size_;
 };
 
 class ObDASDataFetchRes
@@ -349,7 +349,8 @@ int ObDASTaskResultMgr::erase_task_result(int64_t task_id)
 
 int ObDASTaskResultMgr::iterator_task_result(int64_t task_id,
                                              ObChunkDatumStore &datum_store,
-                                             bool &has_more)
+                                             bool &has_more,
+                                             const int64_t fetch_size)
 {
   int ret = OB_SUCCESS;
   has_more = false;
@@ -385,7 +386,7 @@ int ObDASTaskResultMgr::iterator_task_result(int64_t task_id,
       ObChunkDatumStore::Iterator &iter = tcb->result_iter_;
       int64_t &read_rows = tcb->read_rows_;
       while (OB_SUCC(ret) && !has_more) {
-        int64_t memory_limit = das::OB_DAS_MAX_PACKET_SIZE;
+        int64_t memory_limit = fetch_size;
         added = false;
         if (datum_store.get_row_cnt() == 0) {
           // make sure RPC response contains at least one row or one batch
@@ -137,10 +137,11 @@ public:
                        const ObDASScanRtDef * scan_rtdef,
                        ObDASScanOp &scan_op);
   int erase_task_result(int64_t task_id);
-  //从中间结果管理器中获取一个block大小的结果，默认为2M大小
+  //从中间结果管理器中获取不超过fetch_size大小的结果，默认为2M大小
   int iterator_task_result(int64_t task_id,
                            ObChunkDatumStore &datum_store,
-                           bool &has_more);
+                           bool &has_more,
+                           const int64_t fetch_size = das::OB_DAS_MAX_PACKET_SIZE);
   int remove_expired_results();
 private:
   DASTCBMap tcb_map_;
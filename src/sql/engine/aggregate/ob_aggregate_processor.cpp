@@ -27,6 +27,7 @@
 #include "sql/engine/sort/ob_sort_op_impl.h"
 #include "sql/engine/expr/ob_expr_json_func_helper.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 
 namespace oceanbase
@@ -570,7 +571,8 @@ ObAggregateProcessor::ObAggregateProcessor(ObEvalCtx &eval_ctx,
       io_event_observer_(nullptr),
       removal_info_(),
       support_fast_single_row_agg_(false),
-      op_eval_infos_(nullptr)
+      op_eval_infos_(nullptr),
+      approx_percentile_compression_(ObApproxPercentileSketch::DEFAULT_COMPRESSION)
 {
 }
 
@@ -626,6 +628,12 @@ int ObAggregateProcessor::init()
         } else {
           aggr_func_ctxs_.at(i) = ctx;
         }
+      } else if (T_FUN_APPROX_PERCENTILE == aggr_info.get_expr_type()) {
+        omt::ObTenantConfigGuard tenant_config(TENANT_CONF(
+            eval_ctx_.exec_ctx_.get_my_session()->get_effective_tenant_id()));
+        if (tenant_config.is_valid()) {
+          approx_percentile_compression_ = tenant_config->_approx_percentile_compression;
+        }
       }
     }
   } // end for
@@ -1844,6 +1852,16 @@ int ObAggregateProcessor::rollup_aggregation(AggrCell &aggr_cell, AggrCell &roll
       }
       break;
     }
+    case T_FUN_APPROX_PERCENTILE: {
+      if (src_result.is_null()) {
+        // no row aggregated
+      } else if (target_result.is_null()) {
+        ret = clone_aggr_cell(rollup_cell, src_result);
+      } else {
+        ret = approx_percentile_merge(target_result, src_result);
+      }
+      break;
+    }
     case T_FUN_GROUPING: {
       if (OB_UNLIKELY(aggr_info.param_exprs_.count() != 1)) {
         ret = OB_INVALID_ARGUMENT;
@@ -2121,6 +2139,19 @@ int ObAggregateProcessor::prepare_aggr_result(const ObChunkDatumStore::StoredRow
       }
       break;
     }
+    case T_FUN_APPROX_PERCENTILE: {
+      if (OB_UNLIKELY(stored_row.cnt_ != 2)) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("curr_row_results count is not 2", K(stored_row));
+      } else if (OB_FAIL(approx_percentile_init(aggr_cell))) {
+        LOG_WARN("approx percentile init failed", K(ret));
+      } else if (OB_FAIL(approx_percentile_add(aggr_cell.get_iter_result(),
+                                               stored_row.cells()[0],
+                                               stored_row.cells()[1]))) {
+        LOG_WARN("approx percentile add failed", K(ret));
+      }
+      break;
+    }
     case T_FUN_GROUP_CONCAT:
     case T_FUN_GROUP_RANK:
     case T_FUN_GROUP_DENSE_RANK:
@@ -2329,6 +2360,22 @@ int ObAggregateProcessor::process_aggr_batch_result(
       }
       break;
     }
+    case T_FUN_APPROX_PERCENTILE: {
+      if (OB_UNLIKELY(2 != param_exprs->count())) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("The count of APPROX_PERCENTILE is not 2", K(param_exprs->count()));
+      } else if (!aggr_cell.get_is_evaluated()) {
+        if (OB_FAIL(approx_percentile_init(aggr_cell))) {
+          LOG_WARN("approx percentile init failed", K(ret));
+        } else {
+          aggr_cell.set_is_evaluated(true);
+        }
+      }
+      if (OB_SUCC(ret)) {
+        ret = approx_percentile_calc_batch(aggr_cell.get_iter_result(), param_exprs, selector);
+      }
+      break;
+    }
     case T_FUN_APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE: {
       if (1 != param_exprs->count()) {
         ret = OB_INVALID_ARGUMENT;
@@ -2557,6 +2604,17 @@ int ObAggregateProcessor::process_aggr_result(const ObChunkDatumStore::StoredRow
       }
       break;
     }
+    case T_FUN_APPROX_PERCENTILE: {
+      if (OB_UNLIKELY(stored_row.cnt_ != 2)) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("curr_row_results count is not 2", K(stored_row));
+      } else {
+        ret = approx_percentile_add(aggr_cell.get_iter_result(),
+                                    stored_row.cells()[0],
+                                    stored_row.cells()[1]);
+      }
+      break;
+    }
     case T_FUN_GROUP_CONCAT:
     case T_FUN_GROUP_RANK:
     case T_FUN_GROUP_DENSE_RANK:
@@ -2835,6 +2893,24 @@ int ObAggregateProcessor::collect_aggr_result(
       ret = aggr_info.expr_->deep_copy_datum(eval_ctx_, aggr_cell.get_iter_result());
       break;
     }
+    case T_FUN_APPROX_PERCENTILE: {
+      ObDatum &sketch = aggr_cell.get_iter_result();
+      double value = 0;
+      bool is_null = true;
+      if (sketch.is_null()) {
+        // no row aggregated
+      } else if (OB_FAIL(ObApproxPercentileSketch::estimate(const_cast<char *>(sketch.ptr_),
+                                                            sketch.len_, value, is_null))) {
+        LOG_WARN("estimate approx percentile failed", K(ret), K(sketch));
+      }
+      if (OB_FAIL(ret)) {
+      } else if (is_null) {
+        result.set_null();
+      } else {
+        result.set_double(value);
+      }
+      break;
+    }
     case T_FUN_APPROX_COUNT_DISTINCT: {
       int64_t tmp_result = OB_INVALID_COUNT;
       ObExprEstimateNdv::llc_estimate_ndv(tmp_result, aggr_cell.get_iter_result().get_string());
@@ -4105,6 +4181,8 @@ int ObAggregateProcessor::number_accumulator(
   uint32_t fast_sum_path_counter = 0;
   int64_t sum_frag_val = 0;
   int64_t sum_int_val = 0;
+  // sum of the leading digits of numbers with exponent 1, weighted BASE
+  int64_t sum_high_val = 0;
   // TODO zuojiao.hzj: add new number accumulator to avoid memory allocate
   char buf_ori_result[ObNumber::MAX_CALC_BYTE_LEN];
   ObDataBuffer allocator_ori_result(buf_ori_result, ObNumber::MAX_CALC_BYTE_LEN);
@@ -4141,6 +4219,24 @@ int ObAggregateProcessor::number_accumulator(
     } else if (src_num.d_.is_1d_negative_integer()) {
       sum_int_val -= src_num.get_digits()[0];
       ++fast_sum_path_counter;
+    } else if (src_num.d_.is_3d_positive_decimal()) {
+      sum_frag_val += src_num.get_digits()[2];
+      sum_int_val += src_num.get_digits()[1];
+      sum_high_val += src_num.get_digits()[0];
+      ++fast_sum_path_counter;
+    } else if (src_num.d_.is_2d_positive_integer()) {
+      sum_int_val += src_num.get_digits()[1];
+      sum_high_val += src_num.get_digits()[0];
+      ++fast_sum_path_counter;
+    } else if (src_num.d_.is_3d_negative_decimal()) {
+      sum_frag_val -= src_num.get_digits()[2];
+      sum_int_val -= src_num.get_digits()[1];
+      sum_high_val -= src_num.get_digits()[0];
+      ++fast_sum_path_counter;
+    } else if (src_num.d_.is_2d_negative_integer()) {
+      sum_int_val -= src_num.get_digits()[1];
+      sum_high_val -= src_num.get_digits()[0];
+      ++fast_sum_path_counter;
     } else {
       if (OB_UNLIKELY(!ori_result_copied)) {
         // copy result to ori_result to fall back
@@ -4188,6 +4284,10 @@ int ObAggregateProcessor::number_accumulator(
     if (OB_SUCC(ret)) {
       result.assign(res.d_.desc_, res.get_digits());
     }
+  } else if (OB_SUCC(ret) && !all_skip && 0 != sum_high_val
+             && OB_FAIL(merge_high_digit_sum(sum_high_val, allocator1, allocator2,
+                                             normal_sum_path_counter, result))) {
+    LOG_WARN("merge high digit sum failed", K(ret), K(sum_high_val), K(result));
   } else if (OB_SUCC(ret) && !all_skip) {
     // construct sum result into number format
     const int64_t base = ObNumber::BASE;
@@ -4281,6 +4381,42 @@ int ObAggregateProcessor::number_accumulator(
   return ret;
 }
 
+// Add sum_high_val * BASE into result. sum_high_val is the sum of the leading digits of the
+// numbers with exponent 1 (NUM_DESC_3DIGITS_*_DECIMAL and NUM_DESC_2DIGITS_*_INTEGER) accumulated
+// by number_accumulator. It is converted from int64 and then scaled by one more exponent.
+int ObAggregateProcessor::merge_high_digit_sum(
+    const int64_t sum_high_val,
+    ObDataBuffer &allocator1,
+    ObDataBuffer &allocator2,
+    uint32_t &normal_sum_path_counter,
+    ObNumber &result)
+{
+  int ret = OB_SUCCESS;
+  char buf_high[ObNumber::MAX_CALC_BYTE_LEN];
+  ObDataBuffer allocator_high(buf_high, ObNumber::MAX_CALC_BYTE_LEN);
+  ObNumber high_nmb;
+  ObNumber res;
+  if (OB_FAIL(high_nmb.from(sum_high_val, allocator_high))) {
+    LOG_WARN("number from int64 failed", K(ret), K(sum_high_val));
+  } else {
+    // exponent of negative number is stored inverted, see ObNumber::get_decode_exp
+    if (ObNumber::POSITIVE == high_nmb.d_.sign_) {
+      high_nmb.d_.exp_ += 1;
+    } else {
+      high_nmb.d_.exp_ -= 1;
+    }
+    ObDataBuffer &allocator = (normal_sum_path_counter % 2 == 0) ? allocator1 : allocator2;
+    allocator.free();
+    if (OB_FAIL(result.add_v3(high_nmb, res, allocator, true, true))) {
+      LOG_WARN("number add failed", K(ret), K(high_nmb), K(result));
+    } else {
+      result = res;
+      ++normal_sum_path_counter;
+    }
+  }
+  return ret;
+}
+
 int ObAggregateProcessor::init_group_extra_aggr_info(
   AggrCell &aggr_cell,
   const ObAggrInfo &aggr_info
@@ -4499,6 +4635,45 @@ int ObAggregateProcessor::approx_count_calc_batch(
   return ret;
 }
 
+template <typename T>
+int ObAggregateProcessor::approx_percentile_calc_batch(
+  ObDatum &sketch,
+  const ObIArray<ObExpr *> *param_exprs,
+  const T &selector
+)
+{
+  int ret = OB_SUCCESS;
+  // gather the not null values and add them to the sketch in bulk
+  const int64_t BUF_CNT = 256;
+  double values[BUF_CNT];
+  int64_t value_cnt = 0;
+  bool param_checked = false;
+  char *buf = const_cast<char *>(sketch.ptr_);
+  ObDatumVector value_datums = param_exprs->at(0)->locate_expr_datumvector(eval_ctx_);
+  ObDatumVector percentile_datums = param_exprs->at(1)->locate_expr_datumvector(eval_ctx_);
+  for (auto it = selector.begin(); OB_SUCC(ret) && it < selector.end(); selector.next(it)) {
+    uint64_t nth_row = selector.get_batch_index(it);
+    const ObDatum *value = value_datums.at(nth_row);
+    if (value->is_null()) {
+      // do nothing
+    } else if (!param_checked
+               && OB_FAIL(approx_percentile_set_param(sketch, *percentile_datums.at(nth_row)))) {
+      LOG_WARN("set percentile failed", K(ret));
+    } else {
+      param_checked = true;
+      values[value_cnt++] = value->get_double();
+      if (BUF_CNT == value_cnt) {
+        ret = ObApproxPercentileSketch::add_batch(buf, sketch.len_, values, value_cnt);
+        value_cnt = 0;
+      }
+    }
+  }
+  if (OB_SUCC(ret) && value_cnt > 0) {
+    ret = ObApproxPercentileSketch::add_batch(buf, sketch.len_, values, value_cnt);
+  }
+  return ret;
+}
+
 template <typename T>
 int ObAggregateProcessor::add_calc_batch(
     ObDatum &dst, const ObDatumVector &src, AggrCell &aggr_cell, const ObAggrInfo &aggr_info,
@@ -4978,6 +5153,64 @@ int ObAggregateProcessor::llc_init_empty(ObExpr &expr, ObEvalCtx &eval_ctx)
   return ret;
 }
 
+int ObAggregateProcessor::approx_percentile_init(AggrCell &aggr_cell)
+{
+  int ret = OB_SUCCESS;
+  const int64_t sketch_size = ObApproxPercentileSketch::get_size(approx_percentile_compression_);
+  ObDatum &sketch = aggr_cell.get_iter_result();
+  if (OB_FAIL(clone_cell(aggr_cell, sizeof(int64_t) * 2 + sketch_size, nullptr))) {
+    LOG_WARN("failed to clone cell", K(ret), K(sketch_size));
+  } else {
+    sketch.pack_ = static_cast<uint32_t>(sketch_size);
+    if (OB_FAIL(ObApproxPercentileSketch::init(const_cast<char *>(sketch.ptr_), sketch_size,
+                                               approx_percentile_compression_))) {
+      LOG_WARN("init approx percentile sketch failed", K(ret),
+               K(approx_percentile_compression_));
+    }
+  }
+  return ret;
+}
+
+int ObAggregateProcessor::approx_percentile_set_param(ObDatum &sketch, const ObDatum &percentile)
+{
+  int ret = OB_SUCCESS;
+  if (percentile.is_null()) {
+    ret = OB_ERR_PERCENTILE_VALUE_INVALID;
+    LOG_WARN("percentile value is null", K(ret));
+  } else if (OB_FAIL(ObApproxPercentileSketch::set_percentile(const_cast<char *>(sketch.ptr_),
+                                                              sketch.len_,
+                                                              percentile.get_double()))) {
+    LOG_WARN("set percentile failed", K(ret), K(percentile));
+  }
+  return ret;
+}
+
+int ObAggregateProcessor::approx_percentile_add(ObDatum &sketch,
+                                                const ObDatum &value,
+                                                const ObDatum &percentile)
+{
+  int ret = OB_SUCCESS;
+  if (value.is_null()) {
+    // do nothing
+  } else if (OB_FAIL(approx_percentile_set_param(sketch, percentile))) {
+    LOG_WARN("set percentile failed", K(ret));
+  } else if (OB_FAIL(ObApproxPercentileSketch::add(const_cast<char *>(sketch.ptr_), sketch.len_,
+                                                   value.get_double()))) {
+    LOG_WARN("add value to approx percentile sketch failed", K(ret));
+  }
+  return ret;
+}
+
+int ObAggregateProcessor::approx_percentile_merge(ObDatum &sketch, const ObDatum &new_sketch)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ObApproxPercentileSketch::merge(const_cast<char *>(sketch.ptr_), sketch.len_,
+                                              new_sketch.ptr_, new_sketch.len_))) {
+    LOG_WARN("merge approx percentile sketch failed", K(ret), K(sketch), K(new_sketch));
+  }
+  return ret;
+}
+
 uint64_t ObAggregateProcessor::llc_calc_hash_value(const ObChunkDatumStore::StoredRow &stored_row,
     const ObIArray<ObExpr *> &param_exprs, bool &has_null_cell)
 {
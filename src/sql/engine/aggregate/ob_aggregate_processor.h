@@ -29,6 +29,7 @@
 #include "sql/engine/expr/ob_expr_dll_udf.h"
 #include "sql/engine/expr/ob_rt_datum_arith.h"
 #include "share/stat/ob_hybrid_hist_estimator.h"
+#include "sql/engine/aggregate/ob_approx_percentile_sketch.h"
 
 namespace oceanbase
 {
@@ -701,6 +702,9 @@ private:
   int number_accumulator(
       const ObDatumVector &src, ObDataBuffer &allocator1, ObDataBuffer &allocator2,
       number::ObNumber &result, uint32_t *sum_digits, bool &all_skip, const T &param);
+  int merge_high_digit_sum(
+      const int64_t sum_high_val, ObDataBuffer &allocator1, ObDataBuffer &allocator2,
+      uint32_t &normal_sum_path_counter, number::ObNumber &result);
   template <typename T>
   int max_calc_batch(
       AggrCell &aggr_cell,
@@ -737,6 +741,12 @@ private:
     const T &selector
   );
   template <typename T>
+  int approx_percentile_calc_batch(
+    ObDatum &sketch,
+    const ObIArray<ObExpr *> *param_exprs,
+    const T &selector
+  );
+  template <typename T>
   int group_extra_aggr_calc_batch(
     const ObIArray<ObExpr *> *param_exprs,
     AggrCell &aggr_cell,
@@ -888,6 +898,14 @@ private:
   // HyperLogLogCount-related functions
   int llc_init(AggrCell &aggr_cell);
   int llc_init_empty(ObExpr &expr, ObEvalCtx &eval_ctx);
+
+  // APPROX_PERCENTILE-related functions, the sketch is kept in iter result of the aggr cell
+  int approx_percentile_init(AggrCell &aggr_cell);
+  static int approx_percentile_add(ObDatum &sketch,
+                                   const ObDatum &value,
+                                   const ObDatum &percentile);
+  static int approx_percentile_set_param(ObDatum &sketch, const ObDatum &percentile);
+  static int approx_percentile_merge(ObDatum &sketch, const ObDatum &new_sketch);
   /** (@ banliu.zyd)
    * 对一行计算HyperLogLogCount所需要的hash值，如果行中存在某列有NULL值，has_null_cell会置true
    * @note 需要NULL值判断的原因是APPROX_COUNT_DISTINCT统计时不考虑存在NULL的行，而计算hash值
@@ -965,6 +983,8 @@ private:
   RemovalInfo removal_info_;
   bool support_fast_single_row_agg_;
   ObIArray<ObEvalInfo *> *op_eval_infos_;
+  // compression of APPROX_PERCENTILE sketches, read from tenant config in init()
+  int64_t approx_percentile_compression_;
 };
 
 struct ObAggregateCalcFunc
@@ -0,0 +1,304 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/aggregate/ob_approx_percentile_sketch.h"
+#include <math.h>
+#include <algorithm>
+#include "lib/oblog/ob_log_module.h"
+#include "share/ob_errno.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+struct ObCentroidCmp
+{
+  bool operator()(const ObApproxPercentileSketch::Centroid &l,
+                  const ObApproxPercentileSketch::Centroid &r) const
+  {
+    return l.mean_ < r.mean_;
+  }
+};
+
+// scale function k1 of t-digest: k(q) = compression / (2 * pi) * asin(2q - 1)
+static OB_INLINE double sketch_q_to_k(const double q, const double compression)
+{
+  return compression / (2 * M_PI) * asin(2 * q - 1);
+}
+
+static OB_INLINE double sketch_k_to_q(const double k, const double compression)
+{
+  double q = 1;
+  if (k < compression / 4) {
+    q = (sin(k * 2 * M_PI / compression) + 1) / 2;
+  }
+  return q;
+}
+
+int64_t ObApproxPercentileSketch::get_size(const int64_t compression)
+{
+  return sizeof(Header) + sizeof(Centroid) * 2 * compression;
+}
+
+int ObApproxPercentileSketch::init(char *buf, const int64_t size, const int64_t compression)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf)
+      || OB_UNLIKELY(compression < MIN_COMPRESSION || compression > MAX_COMPRESSION)
+      || OB_UNLIKELY(size != get_size(compression))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(size), K(compression));
+  } else {
+    Header &header = get_header(buf);
+    header.compression_ = static_cast<int32_t>(compression);
+    header.capacity_ = static_cast<int32_t>(2 * compression);
+    header.count_ = 0;
+    header.reserved_ = 0;
+    header.percentile_ = -1;
+    header.total_weight_ = 0;
+    header.min_ = 0;
+    header.max_ = 0;
+  }
+  return ret;
+}
+
+bool ObApproxPercentileSketch::is_valid(const char *buf, const int64_t size)
+{
+  bool valid = false;
+  if (NULL != buf && size >= static_cast<int64_t>(sizeof(Header))) {
+    Header header;
+    MEMCPY(&header, buf, sizeof(Header));
+    valid = header.compression_ >= MIN_COMPRESSION
+        && header.compression_ <= MAX_COMPRESSION
+        && header.capacity_ == 2 * header.compression_
+        && header.count_ >= 0
+        && header.count_ <= header.capacity_
+        && size == get_size(header.compression_);
+  }
+  return valid;
+}
+
+OB_INLINE int ObApproxPercentileSketch::add_centroid(Header &header,
+                                                     Centroid *centroids,
+                                                     const double mean,
+                                                     const double weight)
+{
+  int ret = OB_SUCCESS;
+  if (header.count_ >= header.capacity_) {
+    compress(header, centroids);
+  }
+  if (OB_UNLIKELY(header.count_ >= header.capacity_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sketch is full after compress", K(ret), K(header.count_), K(header.capacity_));
+  } else {
+    if (0 == header.total_weight_) {
+      header.min_ = mean;
+      header.max_ = mean;
+    } else {
+      header.min_ = std::min(header.min_, mean);
+      header.max_ = std::max(header.max_, mean);
+    }
+    centroids[header.count_].mean_ = mean;
+    centroids[header.count_].weight_ = weight;
+    header.count_ += 1;
+    header.total_weight_ += weight;
+  }
+  return ret;
+}
+
+int ObApproxPercentileSketch::add(char *buf, const int64_t size, const double value)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(size < static_cast<int64_t>(sizeof(Header)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid sketch", K(ret), KP(buf), K(size));
+  } else if (OB_FAIL(add_centroid(get_header(buf), get_centroids(buf), value, 1))) {
+    LOG_WARN("add centroid failed", K(ret));
+  }
+  return ret;
+}
+
+int ObApproxPercentileSketch::add_batch(char *buf,
+                                        const int64_t size,
+                                        const double *values,
+                                        const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(size < static_cast<int64_t>(sizeof(Header)))
+      || OB_UNLIKELY(count > 0 && NULL == values)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid sketch", K(ret), KP(buf), K(size), KP(values), K(count));
+  } else {
+    Header &header = get_header(buf);
+    Centroid *centroids = get_centroids(buf);
+    for (int64_t i = 0; OB_SUCC(ret) && i < count; i++) {
+      ret = add_centroid(header, centroids, values[i], 1);
+    }
+  }
+  return ret;
+}
+
+int ObApproxPercentileSketch::merge(char *dst,
+                                    const int64_t dst_size,
+                                    const char *src,
+                                    const int64_t src_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_valid(dst, dst_size)) || OB_UNLIKELY(!is_valid(src, src_size))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid sketch", K(ret), KP(dst), K(dst_size), KP(src), K(src_size));
+  } else {
+    // %src may come from a stored row and not be aligned, copy out each centroid
+    Header &header = get_header(dst);
+    Centroid *centroids = get_centroids(dst);
+    Header src_header;
+    MEMCPY(&src_header, src, sizeof(Header));
+    if (header.percentile_ < 0) {
+      header.percentile_ = src_header.percentile_;
+    }
+    const char *src_centroids = src + sizeof(Header);
+    for (int64_t i = 0; OB_SUCC(ret) && i < src_header.count_; i++) {
+      Centroid c;
+      MEMCPY(&c, src_centroids + i * sizeof(Centroid), sizeof(Centroid));
+      ret = add_centroid(header, centroids, c.mean_, c.weight_);
+    }
+    if (OB_SUCC(ret) && src_header.total_weight_ > 0) {
+      // keep the exact extremes of %src, the centroids only carry their means
+      header.min_ = std::min(header.min_, src_header.min_);
+      header.max_ = std::max(header.max_, src_header.max_);
+    }
+  }
+  return ret;
+}
+
+void ObApproxPercentileSketch::compress(Header &header, Centroid *centroids)
+{
+  if (header.count_ > 1) {
+    std::sort(centroids, centroids + header.count_, ObCentroidCmp());
+    const double total = header.total_weight_;
+    const double compression = header.compression_;
+    double weight_so_far = 0;
+    double q_limit = sketch_k_to_q(sketch_q_to_k(0, compression) + 1, compression);
+    Centroid cur = centroids[0];
+    int32_t out = 0;
+    for (int32_t i = 1; i < header.count_; i++) {
+      const Centroid &next = centroids[i];
+      const double proposed = cur.weight_ + next.weight_;
+      if ((weight_so_far + proposed) / total <= q_limit) {
+        cur.mean_ += (next.mean_ - cur.mean_) * next.weight_ / proposed;
+        cur.weight_ = proposed;
+      } else {
+        weight_so_far += cur.weight_;
+        centroids[out++] = cur;
+        q_limit = sketch_k_to_q(sketch_q_to_k(weight_so_far / total, compression) + 1,
+                                compression);
+        cur = next;
+      }
+    }
+    centroids[out++] = cur;
+    header.count_ = out;
+  }
+}
+
+int ObApproxPercentileSketch::set_percentile(char *buf, const int64_t size, const double percentile)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(size < static_cast<int64_t>(sizeof(Header)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid sketch", K(ret), KP(buf), K(size));
+  } else if (OB_UNLIKELY(percentile < 0 || percentile > 1)) {
+    ret = OB_ERR_PERCENTILE_VALUE_INVALID;
+    LOG_WARN("invalid percentile value", K(ret), K(percentile));
+  } else {
+    get_header(buf).percentile_ = percentile;
+  }
+  return ret;
+}
+
+int ObApproxPercentileSketch::estimate(char *buf, const int64_t size, double &result, bool &is_null)
+{
+  int ret = OB_SUCCESS;
+  is_null = false;
+  if (OB_UNLIKELY(!is_valid(buf, size))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid sketch", K(ret), KP(buf), K(size));
+  } else if (0 == get_header(buf).count_) {
+    is_null = true;
+  } else if (OB_FAIL(get_percentile(buf, size, get_header(buf).percentile_, result, is_null))) {
+    LOG_WARN("get percentile failed", K(ret));
+  }
+  return ret;
+}
+
+int ObApproxPercentileSketch::get_percentile(char *buf,
+                                             const int64_t size,
+                                             const double percentile,
+                                             double &result,
+                                             bool &is_null)
+{
+  int ret = OB_SUCCESS;
+  is_null = false;
+  result = 0;
+  if (OB_UNLIKELY(!is_valid(buf, size))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid sketch", K(ret), KP(buf), K(size));
+  } else if (OB_UNLIKELY(percentile < 0 || percentile > 1)) {
+    ret = OB_ERR_PERCENTILE_VALUE_INVALID;
+    LOG_WARN("invalid percentile value", K(ret), K(percentile));
+  } else {
+    Header &header = get_header(buf);
+    Centroid *centroids = get_centroids(buf);
+    if (0 == header.count_) {
+      is_null = true;
+    } else {
+      compress(header, centroids);
+      // the centroid i covers the weight around its center, interpolate linearly between the
+      // centers of adjacent centroids, and between the extremes and the outermost centroids
+      const double target = percentile * header.total_weight_;
+      const Centroid &first = centroids[0];
+      const Centroid &last = centroids[header.count_ - 1];
+      if (target <= first.weight_ / 2) {
+        result = first.weight_ <= 1 ? first.mean_ :
+            header.min_ + (first.mean_ - header.min_) * target / (first.weight_ / 2);
+      } else if (target >= header.total_weight_ - last.weight_ / 2) {
+        const double tail = header.total_weight_ - target;
+        result = last.weight_ <= 1 ? last.mean_ :
+            header.max_ - (header.max_ - last.mean_) * tail / (last.weight_ / 2);
+      } else {
+        double center = first.weight_ / 2;
+        bool found = false;
+        for (int32_t i = 0; !found && i < header.count_ - 1; i++) {
+          const double gap = (centroids[i].weight_ + centroids[i + 1].weight_) / 2;
+          if (target <= center + gap) {
+            const double left = centroids[i].mean_;
+            const double right = centroids[i + 1].mean_;
+            result = left + (right - left) * (target - center) / gap;
+            found = true;
+          } else {
+            center += gap;
+          }
+        }
+        if (!found) {
+          result = last.mean_;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_AGGREGATE_OB_APPROX_PERCENTILE_SKETCH_H_
+#define OCEANBASE_SQL_ENGINE_AGGREGATE_OB_APPROX_PERCENTILE_SKETCH_H_
+
+#include "lib/ob_define.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Mergeable quantile sketch (merging t-digest) used by APPROX_PERCENTILE / APPROX_MEDIAN.
+//
+// Like the llc bitmap of APPROX_COUNT_DISTINCT, the sketch lives in a flat buffer of fixed
+// size which is determined by the compression, so it can be kept in the aggregate cell,
+// merged in place and shipped as a string datum without extra serialization:
+//
+//   | Header | Centroid[capacity_] |
+//
+// Values are appended as centroids of weight 1, the centroids are compressed when the buffer
+// is full. Larger compression means more centroids and better accuracy, the rank error is
+// about O(1/compression) and smaller near both tails.
+class ObApproxPercentileSketch
+{
+public:
+  static const int64_t MIN_COMPRESSION = 10;
+  static const int64_t MAX_COMPRESSION = 1000;
+  static const int64_t DEFAULT_COMPRESSION = 100;
+
+  struct Header
+  {
+    int32_t compression_;
+    int32_t capacity_;
+    int32_t count_;
+    int32_t reserved_;
+    // percentile requested by the aggregate, negative if not set yet
+    double percentile_;
+    double total_weight_;
+    double min_;
+    double max_;
+  };
+
+  struct Centroid
+  {
+    double mean_;
+    double weight_;
+  };
+
+  static int64_t get_size(const int64_t compression);
+  // init an empty sketch in %buf, %size must be get_size(compression)
+  static int init(char *buf, const int64_t size, const int64_t compression);
+  static int add(char *buf, const int64_t size, const double value);
+  static int add_batch(char *buf, const int64_t size, const double *values, const int64_t count);
+  // merge sketch %src into %dst, the two sketches may have different compression
+  static int merge(char *dst, const int64_t dst_size, const char *src, const int64_t src_size);
+  // record the percentile requested by the aggregate, which must be in [0, 1]
+  static int set_percentile(char *buf, const int64_t size, const double percentile);
+  // estimate value of %percentile (in [0, 1]), %is_null is set if the sketch is empty.
+  // The centroids of %buf are compressed.
+  static int get_percentile(char *buf, const int64_t size, const double percentile,
+                            double &result, bool &is_null);
+  // estimate value of the recorded percentile
+  static int estimate(char *buf, const int64_t size, double &result, bool &is_null);
+  static bool is_valid(const char *buf, const int64_t size);
+private:
+  static int add_centroid(Header &header, Centroid *centroids,
+                          const double mean, const double weight);
+  static void compress(Header &header, Centroid *centroids);
+  static OB_INLINE Header &get_header(char *buf)
+  {
+    return *reinterpret_cast<Header *>(buf);
+  }
+  static OB_INLINE Centroid *get_centroids(char *buf)
+  {
+    return reinterpret_cast<Centroid *>(buf + sizeof(Header));
+  }
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SQL_ENGINE_AGGREGATE_OB_APPROX_PERCENTILE_SKETCH_H_
@@ -14,6 +14,7 @@
 
 #include "sql/engine/expr/ob_expr_char_length.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_string_kernel.h"
 
 namespace oceanbase
 {
@@ -73,8 +74,8 @@ int ObExprCharLength::eval_char_length(const ObExpr &expr, ObEvalCtx &ctx,
     res.set_null();
   } else if (in_tc != ObTextTC) {
     const ObString &arg_str = arg->get_string();
-    size_t length = ObCharset::strlen_char(expr.args_[0]->datum_meta_.cs_type_,
-                                           arg_str.ptr(), arg_str.length());
+    int64_t length = ObExprStringKernel::strlen_char(expr.args_[0]->datum_meta_.cs_type_,
+                                                     arg_str.ptr(), arg_str.length());
     res.set_int(length);
   } else {
     int64_t char_len = 0;
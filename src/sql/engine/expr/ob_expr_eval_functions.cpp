@@ -1093,7 +1093,12 @@ static ObExpr::EvalBatchFunc g_expr_eval_batch_functions[] = {
   ObExprEncode::eval_encode_batch,                                    /* 107 */
   ObExprDecode::eval_decode_batch,                                    /* 108 */
   ObExprCoalesce::calc_batch_coalesce_expr,                           /* 109 */
-  ObExprIsNot::calc_batch_is_not_null                                 /* 110 */
+  ObExprIsNot::calc_batch_is_not_null,                                /* 110 */
+  ObLocationExprOperator::calc_location_expr_batch,                   /* 111 */
+  ObExprInstr::calc_mysql_instr_expr_batch,                           /* 112 */
+  ObExprLower::calc_lower_batch,                                      /* 113 */
+  ObExprUpper::calc_upper_batch,                                      /* 114 */
+  ObExprJsonExtract::eval_json_extract_batch                          /* 115 */
 };
 
 REG_SER_FUNC_ARRAY(OB_SFA_SQL_EXPR_EVAL,
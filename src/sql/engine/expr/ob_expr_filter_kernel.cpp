@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include "sql/engine/expr/ob_expr_filter_kernel.h"
+#include "sql/engine/expr/ob_batch_eval_util.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+template <ObCmpOp CMP_OP>
+struct ObFilterCmp {};
+
+template <> struct ObFilterCmp<CO_EQ>
+{
+  template <typename T> OB_INLINE static bool cmp(const T l, const T r) { return l == r; }
+};
+template <> struct ObFilterCmp<CO_NE>
+{
+  template <typename T> OB_INLINE static bool cmp(const T l, const T r) { return l != r; }
+};
+template <> struct ObFilterCmp<CO_LT>
+{
+  template <typename T> OB_INLINE static bool cmp(const T l, const T r) { return l < r; }
+};
+template <> struct ObFilterCmp<CO_LE>
+{
+  template <typename T> OB_INLINE static bool cmp(const T l, const T r) { return l <= r; }
+};
+template <> struct ObFilterCmp<CO_GT>
+{
+  template <typename T> OB_INLINE static bool cmp(const T l, const T r) { return l > r; }
+};
+template <> struct ObFilterCmp<CO_GE>
+{
+  template <typename T> OB_INLINE static bool cmp(const T l, const T r) { return l >= r; }
+};
+
+template <typename T, ObCmpOp CMP_OP>
+static int fixed_cmp_filter_kernel(const ObExpr &expr,
+                                   ObEvalCtx &ctx,
+                                   ObBitVector &skip,
+                                   const int64_t size,
+                                   int64_t &output_rows)
+{
+  int ret = OB_SUCCESS;
+  output_rows = 0;
+  const ObExpr &left = *expr.args_[0];
+  const ObExpr &right = *expr.args_[1];
+  if (OB_FAIL(binary_operand_batch_eval(expr, ctx, skip, size, true))) {
+    LOG_WARN("binary operand batch evaluate failed", K(ret), K(expr));
+  } else {
+    // scalar operand (e.g. const) is read from the same datum for every row
+    const ObDatum *l_datums = left.is_batch_result()
+        ? left.locate_batch_datums(ctx) : &left.locate_expr_datum(ctx);
+    const ObDatum *r_datums = right.is_batch_result()
+        ? right.locate_batch_datums(ctx) : &right.locate_expr_datum(ctx);
+    const int64_t l_step = left.is_batch_result() ? 1 : 0;
+    const int64_t r_step = right.is_batch_result() ? 1 : 0;
+    for (int64_t i = 0; i < size; i++) {
+      if (!skip.at(i)) {
+        const ObDatum &l = l_datums[i * l_step];
+        const ObDatum &r = r_datums[i * r_step];
+        if (l.is_null() || r.is_null()
+            || !ObFilterCmp<CMP_OP>::cmp(*reinterpret_cast<const T *>(l.ptr_),
+                                         *reinterpret_cast<const T *>(r.ptr_))) {
+          skip.set(i);
+        } else {
+          output_rows += 1;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+template <typename T>
+static ObExprFilterKernelFunc get_fixed_cmp_filter_kernel(const ObExprOperatorType type)
+{
+  ObExprFilterKernelFunc func = NULL;
+  switch (type) {
+    case T_OP_EQ: func = fixed_cmp_filter_kernel<T, CO_EQ>; break;
+    case T_OP_NE: func = fixed_cmp_filter_kernel<T, CO_NE>; break;
+    case T_OP_LT: func = fixed_cmp_filter_kernel<T, CO_LT>; break;
+    case T_OP_LE: func = fixed_cmp_filter_kernel<T, CO_LE>; break;
+    case T_OP_GT: func = fixed_cmp_filter_kernel<T, CO_GT>; break;
+    case T_OP_GE: func = fixed_cmp_filter_kernel<T, CO_GE>; break;
+    default: break;
+  }
+  return func;
+}
+
+ObExprFilterKernelFunc ObExprFilterKernel::get_kernel(const ObExpr &expr, ObEvalCtx &ctx)
+{
+  ObExprFilterKernelFunc func = NULL;
+  if (2 != expr.arg_cnt_
+      || !expr.is_batch_result()
+      || NULL == expr.eval_batch_func_
+      || expr.get_eval_info(ctx).projected_) {
+    // interpret
+  } else {
+    const ObObjType l_type = expr.args_[0]->datum_meta_.type_;
+    const ObObjType r_type = expr.args_[1]->datum_meta_.type_;
+    const ObObjTypeClass l_tc = ob_obj_type_class(l_type);
+    const ObObjTypeClass r_tc = ob_obj_type_class(r_type);
+    if (ObIntTC == l_tc && ObIntTC == r_tc) {
+      func = get_fixed_cmp_filter_kernel<int64_t>(expr.type_);
+    } else if (ObUIntTC == l_tc && ObUIntTC == r_tc) {
+      func = get_fixed_cmp_filter_kernel<uint64_t>(expr.type_);
+    } else if (l_type != r_type) {
+      // date and time types are compared with the same type only
+    } else if (ObDateType == l_type) {
+      func = get_fixed_cmp_filter_kernel<int32_t>(expr.type_);
+    } else if (ObDateTimeType == l_type || ObTimestampType == l_type || ObTimeType == l_type) {
+      func = get_fixed_cmp_filter_kernel<int64_t>(expr.type_);
+    }
+  }
+  return func;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_EXPR_OB_EXPR_FILTER_KERNEL_H_
+#define OCEANBASE_EXPR_OB_EXPR_FILTER_KERNEL_H_
+
+#include "sql/engine/expr/ob_expr.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Fused kernel of filter: evaluate the filter expr over the rows not skipped and set skip bit
+// of the rows filtered directly, the result datums of the filter expr are not filled.
+// %output_rows is the count of rows not skipped after filtering.
+typedef int (*ObExprFilterKernelFunc)(const ObExpr &expr,
+                                      ObEvalCtx &ctx,
+                                      ObBitVector &skip,
+                                      const int64_t size,
+                                      int64_t &output_rows);
+
+class ObExprFilterKernel
+{
+public:
+  // Return the fused kernel for comparison (=, <>, <, <=, >, >=) of two operands with the same
+  // fixed-width type (int, uint, date, time, datetime), or NULL if %expr should be interpreted.
+  static ObExprFilterKernelFunc get_kernel(const ObExpr &expr, ObEvalCtx &ctx);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_EXPR_OB_EXPR_FILTER_KERNEL_H_
@@ -52,12 +52,29 @@ int ObExprInstr::calc_mysql_instr_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDat
   return ret;
 }
 
+int ObExprInstr::calc_mysql_instr_expr_batch(BATCH_EVAL_FUNC_ARG_DECL)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(2 != expr.arg_cnt_) || OB_ISNULL(expr.args_) ||
+      OB_ISNULL(expr.args_[0]) || OB_ISNULL(expr.args_[1])) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid expr", K(ret), K(expr));
+  } else if (OB_FAIL(ObLocationExprOperator::calc_batch_(expr, *expr.args_[1], *expr.args_[0],
+                                                         ctx, skip, size))) {
+    LOG_WARN("ObLocationExprOperator::calc_batch_ faied", K(ret));
+  }
+  return ret;
+}
+
 int ObExprInstr::cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr,
                                     ObExpr &rt_expr) const
 {
   UNUSED(op_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = calc_mysql_instr_expr;
+  if (ObLocationExprOperator::can_calc_batch(rt_expr)) {
+    rt_expr.eval_batch_func_ = calc_mysql_instr_expr_batch;
+  }
   return OB_SUCCESS;
 }
 
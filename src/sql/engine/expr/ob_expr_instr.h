@@ -26,6 +26,7 @@ public:
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                                ObExpr &rt_expr) const;
   static int calc_mysql_instr_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  static int calc_mysql_instr_expr_batch(BATCH_EVAL_FUNC_ARG_DECL);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprInstr);
 };
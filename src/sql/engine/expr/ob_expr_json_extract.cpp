@@ -93,18 +93,15 @@ int ObExprJsonExtract::eval_json_extract_null(const ObExpr &expr, ObEvalCtx &ctx
   return OB_SUCCESS;
 }
 
-int ObExprJsonExtract::eval_json_extract(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res)
+int ObExprJsonExtract::get_json_doc(const ObExpr &expr, ObEvalCtx &ctx,
+                                     common::ObArenaAllocator &allocator,
+                                     ObIJsonBase *&j_base, bool &is_null_result)
 {
   int ret = OB_SUCCESS;
   ObDatum *json_datum = NULL;
   ObExpr *json_arg = expr.args_[0];
   ObObjType val_type = json_arg->datum_meta_.type_;
   ObCollationType cs_type = json_arg->datum_meta_.cs_type_;
-  ObIJsonBase *j_base = NULL;
-  bool is_null_result = false;
-  bool may_match_many = (expr.arg_cnt_ > 2);
-  ObEvalCtx::TempAllocGuard tmp_alloc_g(ctx);
-  common::ObArenaAllocator &allocator = tmp_alloc_g.get_allocator();
   if (expr.datum_meta_.cs_type_ != CS_TYPE_UTF8MB4_BIN) {
     ret = OB_ERR_INVALID_JSON_CHARSET;
     LOG_WARN("invalid out put charset", K(ret), K(expr.datum_meta_.cs_type_));
@@ -137,6 +134,63 @@ int ObExprJsonExtract::eval_json_extract(const ObExpr &expr, ObEvalCtx &ctx, ObD
       LOG_USER_ERROR(OB_ERR_INVALID_JSON_TEXT_IN_PARAM);
     }
     LOG_WARN("fail to handle json param 0 in json extract in new sql engine", K(ret));
+  }
+  return ret;
+}
+
+int ObExprJsonExtract::pack_json_extract_res(const ObExpr &expr, ObEvalCtx &ctx,
+                                              common::ObArenaAllocator &allocator,
+                                              ObJsonBaseVector &hit,
+                                              const bool may_match_many,
+                                              ObDatum &res)
+{
+  int ret = OB_SUCCESS;
+  int32_t hit_size = hit.size();
+  ObJsonArray j_arr_res(&allocator);
+  ObIJsonBase *jb_res = NULL;
+  if (hit_size == 0) {
+    res.set_null();
+  } else {
+    if (hit_size == 1 && (may_match_many == false)) {
+      jb_res = hit[0];
+    } else {
+      jb_res = &j_arr_res;
+      ObJsonNode *j_node = NULL;
+      ObIJsonBase *jb_node = NULL;
+      for (int32_t i = 0; OB_SUCC(ret) && i < hit_size; i++) {
+        if (ObJsonBaseFactory::transform(&allocator, hit[i], ObJsonInType::JSON_TREE, jb_node)) { // to tree
+          LOG_WARN("fail to transform to tree", K(ret), K(i), K(*(hit[i])));
+        } else {
+          j_node = static_cast<ObJsonNode *>(jb_node);
+          if (OB_FAIL(jb_res->array_append(j_node->clone(&allocator)))) {
+            LOG_WARN("result array append failed", K(ret), K(i), K(*j_node));
+          }
+        }
+      }
+    }
+
+    ObString raw_str;
+    if (OB_FAIL(ret)) {
+      LOG_WARN("json extarct get results failed", K(ret));
+    } else if (OB_FAIL(jb_res->get_raw_binary(raw_str, &allocator))) {
+      LOG_WARN("json extarct get result binary failed", K(ret));
+    } else if (OB_FAIL(ObJsonExprHelper::pack_json_str_res(expr, ctx, res, raw_str))) {
+      LOG_WARN("fail to pack json result", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObExprJsonExtract::eval_json_extract(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res)
+{
+  int ret = OB_SUCCESS;
+  ObIJsonBase *j_base = NULL;
+  bool is_null_result = false;
+  bool may_match_many = (expr.arg_cnt_ > 2);
+  ObEvalCtx::TempAllocGuard tmp_alloc_g(ctx);
+  common::ObArenaAllocator &allocator = tmp_alloc_g.get_allocator();
+  if (OB_FAIL(get_json_doc(expr, ctx, allocator, j_base, is_null_result))) {
+    LOG_WARN("fail to get json doc", K(ret));
   } else if (is_null_result ==  false) {
     ObJsonBaseVector hit;
     ObJsonPathCache ctx_cache(&allocator);
@@ -165,45 +219,112 @@ int ObExprJsonExtract::eval_json_extract(const ObExpr &expr, ObEvalCtx &ctx, ObD
       }
     }
 
-    int32_t hit_size = hit.size();
-    ObJsonArray j_arr_res(&allocator);
-    ObIJsonBase *jb_res = NULL;
     if (OB_UNLIKELY(OB_FAIL(ret))) {
       LOG_WARN("json seek failed", K(ret));
-    } else if (hit_size == 0 || is_null_result) {
+    } else if (is_null_result) {
       res.set_null();
-    } else {
-      if (hit_size == 1 && (may_match_many == false)) {
-        jb_res = hit[0];
+    } else if (OB_FAIL(pack_json_extract_res(expr, ctx, allocator, hit, may_match_many, res))) {
+      LOG_WARN("fail to pack json extract result", K(ret));
+    }
+  } else if (OB_SUCC(ret) && is_null_result) {
+    res.set_null();
+  }
+
+  return ret;
+}
+
+int ObExprJsonExtract::get_json_paths(const ObExpr &expr, ObEvalCtx &ctx,
+                                       common::ObArenaAllocator &allocator,
+                                       ObJsonPathCache *path_cache,
+                                       ObIArray<ObJsonPath *> &paths,
+                                       bool &is_null_path,
+                                       bool &may_match_many)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 1; OB_SUCC(ret) && !is_null_path && i < expr.arg_cnt_; i++) {
+    ObDatum *path_data = NULL;
+    ObJsonPath *j_path = NULL;
+    ObString path_text;
+    if (OB_FAIL(expr.args_[i]->eval(ctx, path_data))) {
+      LOG_WARN("eval json path datum failed", K(ret));
+    } else if (path_data->is_null()) {
+      is_null_path = true;
+    } else if (FALSE_IT(path_text = path_data->get_string())) {
+    } else if (OB_FAIL(ObJsonExprHelper::get_json_or_str_data(expr.args_[i], ctx, allocator,
+                                                              path_text, is_null_path))) {
+      LOG_WARN("fail to get real data.", K(ret), K(path_text));
+    } else if (OB_FAIL(ObJsonExprHelper::find_and_add_cache(path_cache, j_path, path_text, i, true))) {
+      LOG_WARN("parse text to path failed", K(path_text), K(ret));
+    } else if (OB_FAIL(paths.push_back(j_path))) {
+      LOG_WARN("failed to push back path", K(ret));
+    } else if (j_path->can_match_many()) {
+      may_match_many = true;
+    }
+  }
+  return ret;
+}
+
+// Path arguments are not batch results (see cg_expr), they are parsed once for the batch when
+// the first not null document is met, and the documents of the batch are seeked with them.
+// Memory of one row is reused by the next row instead of growing with the batch.
+int ObExprJsonExtract::eval_json_extract_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                                const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *results = expr.locate_batch_datums(ctx);
+  ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval json arg batch failed", K(ret));
+  } else {
+    ObEvalCtx::TempAllocGuard tmp_alloc_g(ctx);
+    common::ObArenaAllocator &allocator = tmp_alloc_g.get_allocator();
+    common::ObArenaAllocator row_allocator(ObModIds::OB_SQL_EXPR_CALC,
+                                           OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID());
+    ObJsonPathCache ctx_cache(&allocator);
+    ObJsonPathCache* path_cache = ObJsonExprHelper::get_path_cache_ctx(expr.expr_ctx_id_, &ctx.exec_ctx_);
+    path_cache = ((path_cache != NULL) ? path_cache : &ctx_cache);
+    ObSEArray<ObJsonPath *, 4> paths;
+    bool is_path_parsed = false;
+    bool is_null_path = false;
+    bool may_match_many = (expr.arg_cnt_ > 2);
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+    batch_info_guard.set_batch_size(batch_size);
+    for (int64_t j = 0; OB_SUCC(ret) && j < batch_size; ++j) {
+      ObIJsonBase *j_base = NULL;
+      bool is_null_result = false;
+      ObJsonBaseVector hit;
+      if (skip.at(j) || eval_flags.at(j)) {
+        continue;
+      } else if (FALSE_IT(batch_info_guard.set_batch_idx(j))) {
+      } else if (FALSE_IT(row_allocator.reuse())) {
+      } else if (OB_FAIL(get_json_doc(expr, ctx, row_allocator, j_base, is_null_result))) {
+        LOG_WARN("fail to get json doc", K(ret));
+      } else if (is_null_result) {
+        results[j].set_null();
+      } else if (!is_path_parsed &&
+                 OB_FAIL(get_json_paths(expr, ctx, allocator, path_cache, paths,
+                                        is_null_path, may_match_many))) {
+        LOG_WARN("fail to get json paths", K(ret));
+      } else if (FALSE_IT(is_path_parsed = true)) {
+      } else if (is_null_path) {
+        results[j].set_null();
       } else {
-        jb_res = &j_arr_res;
-        ObJsonNode *j_node = NULL;
-        ObIJsonBase *jb_node = NULL;
-        for (int32_t i = 0; OB_SUCC(ret) && i < hit_size; i++) {
-          if (ObJsonBaseFactory::transform(&allocator, hit[i], ObJsonInType::JSON_TREE, jb_node)) { // to tree
-            LOG_WARN("fail to transform to tree", K(ret), K(i), K(*(hit[i])));
-          } else {
-            j_node = static_cast<ObJsonNode *>(jb_node);
-            if (OB_FAIL(jb_res->array_append(j_node->clone(&allocator)))) {
-              LOG_WARN("result array append failed", K(ret), K(i), K(*j_node));
-            }
+        for (int64_t i = 0; OB_SUCC(ret) && i < paths.count(); i++) {
+          if (OB_FAIL(j_base->seek(*paths.at(i), paths.at(i)->path_node_cnt(), true, false, hit))) {
+            LOG_WARN("json seek failed", K(ret), K(i));
           }
         }
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(pack_json_extract_res(expr, ctx, row_allocator, hit,
+                                                 may_match_many, results[j]))) {
+          LOG_WARN("fail to pack json extract result", K(ret));
+        }
       }
-
-      ObString raw_str;
-      if (OB_FAIL(ret)) {
-        LOG_WARN("json extarct get results failed", K(ret));
-      } else if (OB_FAIL(jb_res->get_raw_binary(raw_str, &allocator))) {
-        LOG_WARN("json extarct get result binary failed", K(ret));
-      } else if (OB_FAIL(ObJsonExprHelper::pack_json_str_res(expr, ctx, res, raw_str))) {
-        LOG_WARN("fail to pack json result", K(ret));
+      if (OB_SUCC(ret)) {
+        eval_flags.set(j);
       }
     }
-  } else if (OB_SUCC(ret) && is_null_result) {
-    res.set_null();
   }
-
   return ret;
 }
 
@@ -216,6 +337,13 @@ int ObExprJsonExtract::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_ex
       rt_expr.eval_func_ = eval_json_extract_null;
   } else {
       rt_expr.eval_func_ = eval_json_extract;
+      bool is_const_path = true;
+      for (int64_t i = 1; is_const_path && i < rt_expr.arg_cnt_; i++) {
+        is_const_path = !rt_expr.args_[i]->is_batch_result();
+      }
+      if (rt_expr.args_[0]->is_batch_result() && is_const_path) {
+        rt_expr.eval_batch_func_ = eval_json_extract_batch;
+      }
   }
   return OB_SUCCESS;
 }
@@ -15,6 +15,8 @@
 #define OCEANBASE_SQL_OB_EXPR_JSON_EXTRACT_H_
 
 #include "sql/engine/expr/ob_expr_operator.h"
+#include "lib/json_type/ob_json_base.h"
+#include "lib/json_type/ob_json_path.h"
 
 using namespace oceanbase::common;
 
@@ -34,11 +36,27 @@ public:
                                 common::ObExprTypeCtx& type_ctx) const override;
   static int eval_json_extract(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res);
   static int eval_json_extract_null(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res);
+  static int eval_json_extract_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                     const ObBitVector &skip, const int64_t batch_size);
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx,
                       const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   virtual bool need_rt_ctx() const override { return true; }
   private:
+    static int get_json_doc(const ObExpr &expr, ObEvalCtx &ctx,
+                            common::ObArenaAllocator &allocator,
+                            ObIJsonBase *&j_base, bool &is_null_result);
+    static int get_json_paths(const ObExpr &expr, ObEvalCtx &ctx,
+                              common::ObArenaAllocator &allocator,
+                              ObJsonPathCache *path_cache,
+                              common::ObIArray<ObJsonPath *> &paths,
+                              bool &is_null_path,
+                              bool &may_match_many);
+    static int pack_json_extract_res(const ObExpr &expr, ObEvalCtx &ctx,
+                                     common::ObArenaAllocator &allocator,
+                                     ObJsonBaseVector &hit,
+                                     const bool may_match_many,
+                                     ObDatum &res);
     DISALLOW_COPY_AND_ASSIGN(ObExprJsonExtract);
 };
 
@@ -19,6 +19,7 @@
 #include "lib/oblog/ob_log.h"
 #include "sql/session/ob_sql_session_info.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_string_kernel.h"
 
 namespace oceanbase
 {
@@ -319,8 +320,11 @@ int ObExprLike::set_instr_info(ObIAllocator *exec_allocator,
   char *pattern_buf = nullptr;
   ObIAllocator *exec_cal_buf = exec_allocator;
   InstrInfo &instr_info = like_ctx.instr_info_;
-  if (cs_type != CS_TYPE_UTF8MB4_BIN) {
-    //we optimize the case in which cs_type == CS_TYPE_UTF8MB4_BIN only
+  const bool ascii_ci = CS_TYPE_UTF8MB4_GENERAL_CI == cs_type
+      && ObExprStringKernel::is_ascii(pattern.ptr(), pattern.length());
+  if (cs_type != CS_TYPE_UTF8MB4_BIN && !ascii_ci) {
+    //we optimize the case in which cs_type == CS_TYPE_UTF8MB4_BIN
+    //or ASCII pattern of CS_TYPE_UTF8MB4_GENERAL_CI only
     //just let it go
   } else if (OB_UNLIKELY(OB_ISNULL(cs = ObCharset::get_charset(cs_type)) ||
                   OB_ISNULL(cs->cset))) {
@@ -338,6 +342,9 @@ int ObExprLike::set_instr_info(ObIAllocator *exec_allocator,
     } else if (OB_FAIL(calc_escape_wc(escape_coll, escape, escape_wc))) {
       LOG_WARN("calc escape wc failed", K(ret), K(escape_coll), K(escape));
     } else {
+      instr_info.ascii_ci_ = ascii_ci;
+      instr_info.pattern_len_ = pattern.length();
+      instr_info.escape_wc_ = escape_wc;
       //iterate pattern now
       const char *buf_start = pattern_buf;
       const char *buf_end = pattern_buf + pattern.length();
@@ -414,7 +421,7 @@ int ObExprLike::calc_with_instr_mode(T &result,
   int ret = OB_SUCCESS;
   const InstrInfo instr_info = like_ctx.instr_info_;
   const int32_t text_len = text.length();
-  if (OB_UNLIKELY(cs_type != CS_TYPE_UTF8MB4_BIN)) {
+  if (OB_UNLIKELY(cs_type != CS_TYPE_UTF8MB4_BIN && !instr_info.ascii_ci_)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_ERROR("invalid argument(s)", K(ret), K(cs_type), K(text));
   } else if (OB_UNLIKELY(instr_info.empty())) {
@@ -770,6 +777,24 @@ int ObExprLike::like_varchar(const ObExpr &expr, ObEvalCtx &ctx,  ObDatum &expr_
 
 template <bool percent_sign_start, bool percent_sign_end>
 int64_t ObExprLike::match_with_instr_mode(const ObString &text, const InstrInfo instr_info)
+{
+  int64_t res = 0;
+  if (OB_LIKELY(!instr_info.ascii_ci_)) {
+    res = match_instrs<percent_sign_start, percent_sign_end, false>(text, instr_info);
+  } else if (ObExprStringKernel::is_ascii(text.ptr(), text.length())) {
+    res = match_instrs<percent_sign_start, percent_sign_end, true>(text, instr_info);
+  } else {
+    // non-ASCII chars may be equal to ASCII chars in utf8mb4_general_ci, e.g. 'É' and 'e'
+    res = ObCharset::wildcmp(CS_TYPE_UTF8MB4_GENERAL_CI, text,
+                             ObString(instr_info.pattern_len_, instr_info.instr_buf_),
+                             instr_info.escape_wc_,
+                             static_cast<int32_t>('_'), static_cast<int32_t>('%')) ? 1 : 0;
+  }
+  return res;
+}
+
+template <bool percent_sign_start, bool percent_sign_end, bool case_insensitive>
+int64_t ObExprLike::match_instrs(const ObString &text, const InstrInfo &instr_info)
 {
   int64_t res = 0;
   const char *text_ptr = text.ptr();
@@ -784,16 +809,19 @@ int64_t ObExprLike::match_with_instr_mode(const ObString &text, const InstrInfo
     if (text_len < instr_len[0]) {
       match = false;
     } else {
-      int cmp = MEMCMP(text_ptr, instr_pos[0], instr_len[0]);
-      match = 0 == cmp;
+      match = case_insensitive
+          ? ObExprStringKernel::ascii_ci_equal(text_ptr, instr_pos[0], instr_len[0])
+          : 0 == MEMCMP(text_ptr, instr_pos[0], instr_len[0]);
       text_ptr += instr_len[0];
       text_len -= instr_len[0];
       idx++;
     }
   }
-  // memmem for str surrounded by %
+  // search for str surrounded by %
   for (; idx < idx_end && match; idx++) {
-    char *new_text = static_cast<char*>(MEMMEM(text_ptr, text_len, instr_pos[idx], instr_len[idx]));
+    const char *new_text = case_insensitive
+        ? ObExprStringKernel::find_ascii_ci(text_ptr, text_len, instr_pos[idx], instr_len[idx])
+        : ObExprStringKernel::find(text_ptr, text_len, instr_pos[idx], instr_len[idx]);
     text_len -= new_text != NULL ? new_text - text_ptr + instr_len[idx] : 0;
     if (OB_UNLIKELY(text_len < 0)) {
       match = false;
@@ -809,8 +837,10 @@ int64_t ObExprLike::match_with_instr_mode(const ObString &text, const InstrInfo
     if (text_len < instr_len[idx]) {
       match = false;
     } else {
-      match = 0 == MEMCMP(text.ptr() + text.length() - instr_len[idx],
-                          instr_pos[idx], instr_len[idx]);
+      const char *last = text.ptr() + text.length() - instr_len[idx];
+      match = case_insensitive
+          ? ObExprStringKernel::ascii_ci_equal(last, instr_pos[idx], instr_len[idx])
+          : 0 == MEMCMP(last, instr_pos[idx], instr_len[idx]);
     }
   }
   res = match ? 1 : 0;
@@ -42,7 +42,10 @@ class ObExprLike : public ObFuncExprOperator
         instr_cnt_(0),
         instr_info_buf_size_(0),
         instr_buf_(NULL),
-        instr_buf_length_(0)
+        instr_buf_length_(0),
+        ascii_ci_(false),
+        pattern_len_(0),
+        escape_wc_(0)
     { }
 
     int record_pattern(char *&pattern_buf, const common::ObString &pattern);
@@ -54,8 +57,9 @@ class ObExprLike : public ObFuncExprOperator
       instr_mode_ = INVALID_INSTR_MODE;
       instr_total_length_ = 0;
       instr_cnt_ = 0;
+      ascii_ci_ = false;
     }
-    TO_STRING_KV(K_(instr_mode), K_(instr_total_length), K_(instr_cnt),
+    TO_STRING_KV(K_(instr_mode), K_(instr_total_length), K_(instr_cnt), K_(ascii_ci),
         K(static_cast<void *>(instr_buf_)),
         K(common::ObArrayWrap<uint32_t>(instr_lengths_, instr_cnt_)));
 
@@ -74,6 +78,11 @@ class ObExprLike : public ObFuncExprOperator
 
     char *instr_buf_;
     uint32_t instr_buf_length_;
+    // ASCII pattern of utf8mb4_general_ci, instrs of ASCII text are matched case-insensitively,
+    // and the non-ASCII text is matched with the pattern recorded in %instr_buf_ by wildcmp.
+    bool ascii_ci_;
+    uint32_t pattern_len_;
+    int32_t escape_wc_;
   };
   class ObExprLikeContext : public ObExprOperatorCtx
   {
@@ -132,6 +141,8 @@ public:
   template <bool percent_sign_start, bool percent_sign_end>
   static int64_t match_with_instr_mode(const common::ObString &text_val,
                                        const InstrInfo instr_info);
+  template <bool percent_sign_start, bool percent_sign_end, bool case_insensitive>
+  static int64_t match_instrs(const common::ObString &text_val, const InstrInfo &instr_info);
   template <typename T>
   static int calc_with_non_instr_mode(T &result,
                                       const common::ObCollationType coll_type,
@@ -20,6 +20,8 @@
 //#include "sql/engine/expr/ob_expr_promotion_util.h"
 #include "sql/session/ob_sql_session_info.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_string_kernel.h"
+#include "storage/ob_storage_util.h"
 
 namespace oceanbase {
 using namespace common;
@@ -320,6 +322,9 @@ int ObExprLower::cg_expr(ObExprCGCtx &op_cg_ctx,
     LOG_WARN("lower expr cg expr failed", K(ret));
   } else {
     rt_expr.eval_func_ = ObExprLower::calc_lower;
+    if (!ob_is_text_tc(rt_expr.args_[0]->datum_meta_.type_)) {
+      rt_expr.eval_batch_func_ = ObExprLower::calc_lower_batch;
+    }
   }
   return ret;
 }
@@ -333,6 +338,9 @@ int ObExprUpper::cg_expr(ObExprCGCtx &op_cg_ctx,
     LOG_WARN("upper expr cg expr failed", K(ret));
   } else {
     rt_expr.eval_func_ = ObExprUpper::calc_upper;
+    if (!ob_is_text_tc(rt_expr.args_[0]->datum_meta_.type_)) {
+      rt_expr.eval_batch_func_ = ObExprUpper::calc_upper_batch;
+    }
   }
   return ret;
 }
@@ -456,6 +464,78 @@ int ObExprLowerUpper::calc_common(const ObExpr &expr, ObEvalCtx &ctx,
   return ret;
 }
 
+// batch version of calc_common() for varchar, the case of ASCII strings is converted directly
+// if ASCII chars of the collation are stored as single bytes.
+int ObExprLowerUpper::calc_common_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                        const ObBitVector &skip, const int64_t batch_size,
+                                        const bool lower)
+{
+  int ret = OB_SUCCESS;
+  const ObCollationType cs_type = expr.datum_meta_.cs_type_;
+  if (OB_FAIL(expr.args_[0]->eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval param batch failed", K(ret));
+  } else if (OB_UNLIKELY(!ObCharset::is_valid_collation(cs_type))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("charset is null", K(ret), K(cs_type));
+  } else {
+    const bool do_ascii_optimize = storage::can_do_ascii_optimize(cs_type);
+    const uchar multiply = lower ? ObCharset::get_charset(cs_type)->casedn_multiply
+                                 : ObCharset::get_charset(cs_type)->caseup_multiply;
+    ObDatum *res_datums = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      const ObDatum &text_datum = expr.args_[0]->locate_expr_datum(ctx, i);
+      if (text_datum.is_null()) {
+        res_datums[i].set_null();
+      } else {
+        const ObString &m_text = text_datum.get_string();
+        ObString str_result;
+        if (m_text.empty()) {
+          str_result.reset();
+        } else if (do_ascii_optimize
+                   && ObExprStringKernel::is_ascii(m_text.ptr(), m_text.length())) {
+          char *buf = expr.get_str_res_mem(ctx, m_text.length(), i);
+          if (OB_ISNULL(buf)) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_ERROR("alloc memory failed", "size", m_text.length());
+          } else {
+            if (lower) {
+              ObExprStringKernel::ascii_tolower(m_text.ptr(), m_text.length(), buf);
+            } else {
+              ObExprStringKernel::ascii_toupper(m_text.ptr(), m_text.length(), buf);
+            }
+            str_result.assign(buf, m_text.length());
+          }
+        } else {
+          int32_t buf_len = m_text.length() * multiply;
+          char *buf = expr.get_str_res_mem(ctx, buf_len, i);
+          if (OB_ISNULL(buf)) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_ERROR("alloc memory failed", "size", buf_len);
+          } else {
+            int32_t out_len = calc_common_inner(buf, buf_len, m_text, cs_type, lower);
+            str_result.assign(buf, static_cast<int32_t>(out_len));
+          }
+        }
+        if (OB_FAIL(ret)) {
+        } else if (OB_UNLIKELY(is_oracle_mode() && str_result.length() == 0
+                               && ob_is_string_tc(expr.datum_meta_.type_))) {
+          res_datums[i].set_null();
+        } else {
+          res_datums[i].set_string(str_result);
+        }
+      }
+      if (OB_SUCC(ret)) {
+        eval_flags.set(i);
+      }
+    }
+  }
+  return ret;
+}
+
 int ObExprLowerUpper::calc_nls_common(const ObExpr &expr, ObEvalCtx &ctx,
                                       ObDatum &expr_datum, bool lower)
 {
@@ -524,6 +604,16 @@ int ObExprUpper::calc_upper(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_da
   return calc_common(expr, ctx, expr_datum, false, CS_TYPE_INVALID);
 }
 
+int ObExprLower::calc_lower_batch(BATCH_EVAL_FUNC_ARG_DECL)
+{
+  return calc_common_batch(expr, ctx, skip, size, true);
+}
+
+int ObExprUpper::calc_upper_batch(BATCH_EVAL_FUNC_ARG_DECL)
+{
+  return calc_common_batch(expr, ctx, skip, size, false);
+}
+
 int ObExprNlsLower::calc(const ObCollationType cs_type, char *src, int32_t src_len,
                          char *dst, int32_t dst_len, int32_t &out_len) const
 {
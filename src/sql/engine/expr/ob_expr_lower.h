@@ -36,6 +36,9 @@ public:
                               common::ObExprTypeCtx &type_ctx) const;
   static int calc_common(const ObExpr &expr, ObEvalCtx &ctx,
                          ObDatum &expr_datum, bool lower, common::ObCollationType cs_type);
+  static int calc_common_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                               const ObBitVector &skip, const int64_t batch_size,
+                               const bool lower);
   static int calc_nls_common(const ObExpr &expr, ObEvalCtx &ctx,
                              ObDatum &expr_datum, bool lower);
   int cg_expr_common(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr, ObExpr &rt_expr) const;
@@ -66,6 +69,7 @@ public:
                       const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   static int calc_lower(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  static int calc_lower_batch(BATCH_EVAL_FUNC_ARG_DECL);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprLower);
 };
@@ -82,6 +86,7 @@ public:
                       const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   static int calc_upper(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum);
+  static int calc_upper_batch(BATCH_EVAL_FUNC_ARG_DECL);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprUpper);
 };
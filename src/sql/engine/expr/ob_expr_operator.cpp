@@ -32,6 +32,7 @@
 #include "sql/engine/subquery/ob_subplan_filter_op.h"
 #include "lib/timezone/ob_oracle_format_models.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_string_kernel.h"
 #include "sql/resolver/dml/ob_select_stmt.h"
 
 namespace oceanbase
@@ -5321,8 +5322,8 @@ int ObLocationExprOperator::calc_(const ObExpr &expr, const ObExpr &sub_arg,
     if (OB_FAIL(get_calc_cs_type(expr, calc_cs_type))) {
       LOG_WARN("get_calc_cs_type failed", K(ret));
     } else if (!ob_is_text_tc(sub_arg.datum_meta_.type_) && !ob_is_text_tc(ori_arg.datum_meta_.type_)) {
-      uint32_t idx = ObCharset::locate(calc_cs_type, ori_str.ptr(), ori_str.length(),
-                                       sub_str.ptr(), sub_str.length(), pos_int);
+      uint32_t idx = ObExprStringKernel::locate(calc_cs_type, ori_str.ptr(), ori_str.length(),
+                                                sub_str.ptr(), sub_str.length(), pos_int);
       res_datum.set_int(static_cast<int64_t>(idx));
     } else { // at least one of the inputs are text tc
       ObEvalCtx::TempAllocGuard alloc_guard(ctx);
@@ -5374,12 +5375,73 @@ int ObLocationExprOperator::calc_(const ObExpr &expr, const ObExpr &sub_arg,
   return ret;
 }
 
+int ObLocationExprOperator::calc_location_expr_batch(BATCH_EVAL_FUNC_ARG_DECL)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(2 != expr.arg_cnt_) || OB_ISNULL(expr.args_) ||
+      OB_ISNULL(expr.args_[0]) || OB_ISNULL(expr.args_[1])) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid expr", K(ret), K(expr));
+  } else if (OB_FAIL(calc_batch_(expr, *expr.args_[0], *expr.args_[1], ctx, skip, size))) {
+    LOG_WARN("calc_batch_ failed", K(ret));
+  }
+  return ret;
+}
+
+// batch version of calc_() for two varchar params, the position param is not supported
+// because it is evaluated only if the other params are not null.
+int ObLocationExprOperator::calc_batch_(const ObExpr &expr, const ObExpr &sub_arg,
+                                        const ObExpr &ori_arg, ObEvalCtx &ctx,
+                                        const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  ObCollationType calc_cs_type = CS_TYPE_INVALID;
+  if (OB_FAIL(sub_arg.eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval sub arg failed", K(ret));
+  } else if (OB_FAIL(ori_arg.eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("eval ori arg failed", K(ret));
+  } else if (OB_FAIL(get_calc_cs_type(expr, calc_cs_type))) {
+    LOG_WARN("get_calc_cs_type failed", K(ret));
+  } else {
+    ObDatum *res_datums = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    for (int64_t i = 0; i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      const ObDatum &sub = sub_arg.locate_expr_datum(ctx, i);
+      const ObDatum &ori = ori_arg.locate_expr_datum(ctx, i);
+      if (sub.is_null() || ori.is_null()) {
+        res_datums[i].set_null();
+      } else {
+        const ObString &ori_str = ori.get_string();
+        const ObString &sub_str = sub.get_string();
+        uint32_t idx = ObExprStringKernel::locate(calc_cs_type, ori_str.ptr(), ori_str.length(),
+                                                  sub_str.ptr(), sub_str.length(), 1);
+        res_datums[i].set_int(static_cast<int64_t>(idx));
+      }
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
+bool ObLocationExprOperator::can_calc_batch(const ObExpr &rt_expr)
+{
+  return 2 == rt_expr.arg_cnt_
+      && !ob_is_text_tc(rt_expr.args_[0]->datum_meta_.type_)
+      && !ob_is_text_tc(rt_expr.args_[1]->datum_meta_.type_);
+}
+
 int ObLocationExprOperator::cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr,
                                     ObExpr &rt_expr) const
 {
   UNUSED(op_cg_ctx);
   UNUSED(raw_expr);
   rt_expr.eval_func_ = calc_location_expr;
+  if (can_calc_batch(rt_expr)) {
+    rt_expr.eval_batch_func_ = calc_location_expr_batch;
+  }
   return OB_SUCCESS;
 }
 
@@ -1976,6 +1976,10 @@ public:
   static int calc_(const ObExpr &expr, const ObExpr &sub_arg, const ObExpr &ori_arg,
                    ObEvalCtx &ctx, ObDatum &res_datum);
   static int calc_location_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  static int calc_batch_(const ObExpr &expr, const ObExpr &sub_arg, const ObExpr &ori_arg,
+                         ObEvalCtx &ctx, const ObBitVector &skip, const int64_t batch_size);
+  static int calc_location_expr_batch(BATCH_EVAL_FUNC_ARG_DECL);
+  static bool can_calc_batch(const ObExpr &rt_expr);
   static int get_calc_cs_type(const ObExpr &expr, common::ObCollationType &calc_cs_type);
   virtual int cg_expr(ObExprCGCtx &op_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const;
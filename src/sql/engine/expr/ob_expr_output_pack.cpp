@@ -184,6 +184,12 @@ int ObExprOutputPack::eval_output_pack_batch(const ObExpr &expr, ObEvalCtx &ctx,
     LOG_WARN("ctx is not init", K(session), K(sql_ctx), K(schema_guard));
   } else if (OB_FAIL(expr.eval_batch_param_value(ctx, skip, batch_size))) {
     LOG_WARN("failed to eval batch", K(ret));
+  } else if (0 != expr.locate_param_datum(ctx, 0).get_int()) {
+    // text protocol, the 0th parameter is a const
+    if (OB_FAIL(encode_text_batch(expr, ctx, session, alloc, extra_info, schema_guard,
+                                  skip, batch_size))) {
+      LOG_WARN("failed to encode text batch", K(ret), K(batch_size));
+    }
   } else {
     ObEvalCtx::BatchInfoScopeGuard guard(ctx);
     for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
@@ -202,6 +208,147 @@ int ObExprOutputPack::eval_output_pack_batch(const ObExpr &expr, ObEvalCtx &ctx,
 }
 
 
+// Rows of the text protocol are encoded column by column: the encode routine is chosen once
+// per column, and int and string cells which need no conversion are encoded from the datum
+// directly. The encoded cells of each row are copied into the result at last.
+int ObExprOutputPack::encode_text_batch(const ObExpr &expr, ObEvalCtx &ctx,
+                                        ObSQLSessionInfo *session, common::ObIAllocator &alloc,
+                                        ObOutputPackInfo *extra_info,
+                                        share::schema::ObSchemaGetterGuard *schema_guard,
+                                        const ObBitVector &skip, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *result = expr.locate_batch_datums(ctx);
+  ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+  const int64_t column_cnt = expr.arg_cnt_ - 1;
+  ObCharsetType result_charset = CHARSET_INVALID;
+  TextColumnBuf *columns = NULL;
+  if (OB_FAIL(session->get_character_set_results(result_charset))) {
+    LOG_WARN("fail to get result charset", K(ret));
+  } else if (OB_ISNULL(columns = static_cast<TextColumnBuf *>(
+                       alloc.alloc(sizeof(TextColumnBuf) * column_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc column buffers", K(ret), K(column_cnt));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < column_cnt; ++i) {
+    new (&columns[i]) TextColumnBuf();
+    if (OB_FAIL(encode_text_column(expr, ctx, session, alloc, extra_info, schema_guard,
+                                   result_charset, skip, batch_size, i + 1, columns[i]))) {
+      LOG_WARN("failed to encode text column", K(ret), K(i));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+    if (skip.at(i) || eval_flags.at(i)) {
+      continue;
+    }
+    int64_t row_len = 0;
+    char *buf = NULL;
+    for (int64_t j = 0; j < column_cnt; ++j) {
+      row_len += columns[j].offsets_[i + 1] - columns[j].offsets_[i];
+    }
+    if (OB_UNLIKELY(row_len >= MAX_PACK_LEN)) {
+      ret = OB_SIZE_OVERFLOW;
+      LOG_WARN("encode row size overflow ", K(ret), K(row_len));
+    } else if (OB_ISNULL(buf = expr.get_str_res_mem(ctx, row_len, i))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to get str res mem", K(ret), K(row_len));
+    } else {
+      int64_t pos = 0;
+      for (int64_t j = 0; j < column_cnt; ++j) {
+        const int64_t cell_len = columns[j].offsets_[i + 1] - columns[j].offsets_[i];
+        MEMCPY(buf + pos, columns[j].buf_ + columns[j].offsets_[i], cell_len);
+        pos += cell_len;
+      }
+      result[i].set_string(buf, row_len);
+      eval_flags.set(i);
+    }
+  }
+  return ret;
+}
+
+int ObExprOutputPack::encode_text_column(const ObExpr &expr, ObEvalCtx &ctx,
+                                         ObSQLSessionInfo *session, common::ObIAllocator &alloc,
+                                         ObOutputPackInfo *extra_info,
+                                         share::schema::ObSchemaGetterGuard *schema_guard,
+                                         const ObCharsetType result_charset,
+                                         const ObBitVector &skip, const int64_t batch_size,
+                                         const int64_t column_idx, TextColumnBuf &column)
+{
+  int ret = OB_SUCCESS;
+  const ObExpr *arg = expr.args_[column_idx];
+  const ObDatum *datums = arg->locate_batch_datums(ctx);
+  const ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+  const ObObjTypeClass tc = arg->obj_meta_.get_type_class();
+  const ObCollationType cs_type = arg->obj_meta_.get_collation_type();
+  const bool is_zerofill = extra_info->param_fields_.at(column_idx - 1).flags_ & ZEROFILL_FLAG;
+  const bool is_int = (ObIntTC == tc || ObUIntTC == tc) && !is_zerofill;
+  // same as ObObj::convert_string_value_charset(), no conversion needed
+  const bool is_string = ObStringTC == tc
+      && (!ObCharset::is_valid_charset(result_charset) || CHARSET_BINARY == result_charset
+          || CS_TYPE_INVALID == cs_type || CS_TYPE_BINARY == cs_type
+          || ObCharset::charset_type_by_coll(cs_type) == result_charset);
+  ObEvalCtx::BatchInfoScopeGuard guard(ctx);
+  int64_t pos = 0;
+  column.len_ = MAX(batch_size * TEXT_CELL_INIT_LEN, TEXT_COLUMN_MIN_LEN);
+  if (OB_ISNULL(column.buf_ = static_cast<char *>(alloc.alloc(column.len_)))
+      || OB_ISNULL(column.offsets_ = static_cast<int64_t *>(
+                   alloc.alloc(sizeof(int64_t) * (batch_size + 1))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc column buffer", K(ret), K(column.len_), K(batch_size));
+  } else {
+    column.offsets_[0] = 0;
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+    int tmp_ret = (skip.at(i) || eval_flags.at(i)) ? OB_SUCCESS : OB_SIZE_OVERFLOW;
+    // if the column buffer is not enough, enlarge it and encode the cell again
+    while (OB_SUCC(ret) && OB_SUCCESS != tmp_ret) {
+      const ObDatum &datum = datums[arg->is_batch_result() ? i : 0];
+      if (!is_int && !is_string) {
+        guard.set_batch_idx(i);
+        tmp_ret = encode_param_cell(expr, ctx, session, alloc, extra_info, column_idx,
+                                    column.buf_, NULL, schema_guard,
+                                    obmysql::MYSQL_PROTOCOL_TYPE::TEXT, column.len_, pos);
+      } else if (datum.is_null()) {
+        tmp_ret = obmysql::ObMySQLUtil::null_cell_str(column.buf_, column.len_,
+                                                      obmysql::MYSQL_PROTOCOL_TYPE::TEXT,
+                                                      pos, column_idx - 1, NULL);
+      } else if (is_int) {
+        tmp_ret = obmysql::ObMySQLUtil::int_cell_str(column.buf_, column.len_, datum.get_int(),
+                                                     arg->datum_meta_.type_, ObUIntTC == tc,
+                                                     obmysql::MYSQL_PROTOCOL_TYPE::TEXT, pos,
+                                                     false, 0);
+      } else {
+        tmp_ret = obmysql::ObMySQLUtil::varchar_cell_str(column.buf_, column.len_,
+                                                         datum.get_string(), false, pos);
+      }
+      if (OB_SUCCESS == tmp_ret) {
+      } else if (OB_SIZE_OVERFLOW != tmp_ret) {
+        ret = tmp_ret;
+        LOG_WARN("failed to encode cell", K(ret), K(column_idx), K(i));
+      } else {
+        const int64_t new_len = column.len_ * 2;
+        char *new_buf = NULL;
+        if (new_len >= MAX_PACK_LEN) {
+          ret = OB_SIZE_OVERFLOW;
+          LOG_WARN("encode column size overflow", K(ret), K(new_len));
+        } else if (OB_ISNULL(new_buf = static_cast<char *>(alloc.alloc(new_len)))) {
+          ret = OB_ALLOCATE_MEMORY_FAILED;
+          LOG_WARN("failed to alloc column buffer", K(ret), K(new_len));
+        } else {
+          MEMCPY(new_buf, column.buf_, column.offsets_[i]);
+          column.buf_ = new_buf;
+          column.len_ = new_len;
+          pos = column.offsets_[i];
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      column.offsets_[i + 1] = pos;
+    }
+  }
+  return ret;
+}
+
 int ObExprOutputPack::encode_cell(const ObObj &cell, const common::ObIArray<ObField> &param_fields,
                                   char *buf, int64_t len, int64_t &pos, char *bitmap,
                                   int64_t column_num, ObSQLSessionInfo *session,
@@ -579,56 +726,70 @@ int ObExprOutputPack::try_encode_row(const ObExpr &expr, ObEvalCtx &ctx,
 {
   int ret = OB_SUCCESS;
   for (int64_t column_idx = 1; OB_SUCC(ret) && column_idx < expr.arg_cnt_; ++column_idx) {
-    ObDatum &datum = expr.locate_param_datum(ctx, column_idx);
-    ObObj obj;
-    if (OB_FAIL(datum.to_obj(obj, expr.args_[column_idx]->obj_meta_,
-                             expr.args_[column_idx]->obj_datum_map_))) {
-      LOG_WARN("failed to cast to obj", K(ret), K(column_idx));
-    } else {
-      if (obmysql::MYSQL_PROTOCOL_TYPE::BINARY == encode_type) {
-        ObCastMode cast_mode = CM_NONE;
-        if (OB_FAIL(ObSQLUtils::get_default_cast_mode(session, cast_mode))) {
-          LOG_WARN("failed to get default cast mode", K(ret));
-        } else {
-          cast_mode |= CM_WARN_ON_FAIL;
-          if (obj.get_type() != extra_info->param_fields_.at(column_idx - 1).type_.get_type()) {
-            ObCastCtx cast_ctx(&alloc, NULL, cast_mode, CS_TYPE_INVALID);
-             if (OB_FAIL(common::ObObjCaster::to_type(extra_info->param_fields_.at(column_idx - 1).type_.get_type(),
-                                                      cast_ctx,
-                                                      obj,
-                                                      obj))) {
-              LOG_WARN("failed to cast object", K(ret), K(obj),
-              K(obj.get_type()), K(extra_info->param_fields_.at(column_idx - 1).type_.get_type()));
-            }
+    ret = encode_param_cell(expr, ctx, session, alloc, extra_info, column_idx, buffer,
+                            bitmap, schema_guard, encode_type, len, pos);
+  }
+  return ret;
+}
+
+int ObExprOutputPack::encode_param_cell(const ObExpr &expr, ObEvalCtx &ctx,
+                                        ObSQLSessionInfo *session, common::ObIAllocator &alloc,
+                                        ObOutputPackInfo *extra_info, const int64_t column_idx,
+                                        char *buffer, char *bitmap,
+                                        share::schema::ObSchemaGetterGuard *schema_guard,
+                                        obmysql::MYSQL_PROTOCOL_TYPE encode_type,
+                                        const int64_t len, int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  ObDatum &datum = expr.locate_param_datum(ctx, column_idx);
+  ObObj obj;
+  if (OB_FAIL(datum.to_obj(obj, expr.args_[column_idx]->obj_meta_,
+                           expr.args_[column_idx]->obj_datum_map_))) {
+    LOG_WARN("failed to cast to obj", K(ret), K(column_idx));
+  } else {
+    if (obmysql::MYSQL_PROTOCOL_TYPE::BINARY == encode_type) {
+      ObCastMode cast_mode = CM_NONE;
+      if (OB_FAIL(ObSQLUtils::get_default_cast_mode(session, cast_mode))) {
+        LOG_WARN("failed to get default cast mode", K(ret));
+      } else {
+        cast_mode |= CM_WARN_ON_FAIL;
+        if (obj.get_type() != extra_info->param_fields_.at(column_idx - 1).type_.get_type()) {
+          ObCastCtx cast_ctx(&alloc, NULL, cast_mode, CS_TYPE_INVALID);
+           if (OB_FAIL(common::ObObjCaster::to_type(extra_info->param_fields_.at(column_idx - 1).type_.get_type(),
+                                                    cast_ctx,
+                                                    obj,
+                                                    obj))) {
+            LOG_WARN("failed to cast object", K(ret), K(obj),
+            K(obj.get_type()), K(extra_info->param_fields_.at(column_idx - 1).type_.get_type()));
           }
         }
       }
-      if (OB_SUCC(ret)) {
-        if (ob_is_string_tc(obj.get_type()) && CS_TYPE_INVALID != obj.get_collation_type()) {
-          OZ(convert_string_value_charset(obj, alloc, *session));
-        } else if (obj.is_clob_locator()
-                  && OB_FAIL(convert_lob_value_charset(obj, alloc, *session))) {
-          LOG_WARN("convert lob obj charset failed", K(ret));
-        } else if (ob_is_text_tc(obj.get_type())
-                  && OB_FAIL(convert_text_value_charset(obj, expr.obj_meta_.has_lob_header(), alloc, *session))) {
-          LOG_WARN("convert text obj charset failed", K(ret));
-        }
-        if (OB_SUCC(ret)
-            && (obj.is_lob() || obj.is_lob_locator() || obj.is_json())
-            && OB_FAIL(process_lob_locator_results(obj, alloc, *session))) {
-          LOG_WARN("convert lob locator to longtext failed", K(ret));
-        }
-      }
     }
-    if (OB_FAIL(ret)) {
-    } else if (OB_FAIL(encode_cell(obj, extra_info->param_fields_, buffer, len,
-                              pos, bitmap, column_idx - 1/*for encode type expr*/,
-                              session, schema_guard, encode_type))) {
-      if (OB_UNLIKELY(OB_SIZE_OVERFLOW != ret)) {
-        LOG_WARN("failed to encode obj", K(ret), K(column_idx));
+    if (OB_SUCC(ret)) {
+      if (ob_is_string_tc(obj.get_type()) && CS_TYPE_INVALID != obj.get_collation_type()) {
+        OZ(convert_string_value_charset(obj, alloc, *session));
+      } else if (obj.is_clob_locator()
+                && OB_FAIL(convert_lob_value_charset(obj, alloc, *session))) {
+        LOG_WARN("convert lob obj charset failed", K(ret));
+      } else if (ob_is_text_tc(obj.get_type())
+                && OB_FAIL(convert_text_value_charset(obj, expr.obj_meta_.has_lob_header(), alloc, *session))) {
+        LOG_WARN("convert text obj charset failed", K(ret));
+      }
+      if (OB_SUCC(ret)
+          && (obj.is_lob() || obj.is_lob_locator() || obj.is_json())
+          && OB_FAIL(process_lob_locator_results(obj, alloc, *session))) {
+        LOG_WARN("convert lob locator to longtext failed", K(ret));
       }
     }
   }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(encode_cell(obj, extra_info->param_fields_, buffer, len,
+                            pos, bitmap, column_idx - 1/*for encode type expr*/,
+                            session, schema_guard, encode_type))) {
+    if (OB_UNLIKELY(OB_SIZE_OVERFLOW != ret)) {
+      LOG_WARN("failed to encode obj", K(ret), K(column_idx));
+    }
+  }
   return ret;
 }
 
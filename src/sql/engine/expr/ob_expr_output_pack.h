@@ -43,7 +43,17 @@ public:
   static int eval_output_pack_batch(const ObExpr &expr, ObEvalCtx &ctx,
                                     const ObBitVector &skip, const int64_t batch_size);
 private:
+  // encoded cells of one column in a batch, cell i is [offsets_[i], offsets_[i + 1]) of buf_
+  struct TextColumnBuf
+  {
+    TextColumnBuf() : buf_(NULL), len_(0), offsets_(NULL) {}
+    char *buf_;
+    int64_t len_;
+    int64_t *offsets_;
+  };
   static const int64_t MAX_PACK_LEN = 2 * 128 * 1024 * 1024;
+  static const int64_t TEXT_CELL_INIT_LEN = 32;
+  static const int64_t TEXT_COLUMN_MIN_LEN = 4096;
   static int encode_cell(const common::ObObj &cell,
                          const common::ObIArray<common::ObField> &param_fields,
                          char *buf, int64_t len, int64_t &pos, char *bitmap, int64_t column_num,
@@ -56,6 +66,22 @@ private:
                             share::schema::ObSchemaGetterGuard *schema_guard,
                             obmysql::MYSQL_PROTOCOL_TYPE encode_type,
                             const int64_t len, int64_t &pos);
+  static int encode_param_cell(const ObExpr &expr, ObEvalCtx &ctx, ObSQLSessionInfo *session,
+                               common::ObIAllocator &alloc, ObOutputPackInfo *extra_info,
+                               const int64_t column_idx, char *buffer, char *bitmap,
+                               share::schema::ObSchemaGetterGuard *schema_guard,
+                               obmysql::MYSQL_PROTOCOL_TYPE encode_type,
+                               const int64_t len, int64_t &pos);
+  static int encode_text_batch(const ObExpr &expr, ObEvalCtx &ctx, ObSQLSessionInfo *session,
+                               common::ObIAllocator &alloc, ObOutputPackInfo *extra_info,
+                               share::schema::ObSchemaGetterGuard *schema_guard,
+                               const ObBitVector &skip, const int64_t batch_size);
+  static int encode_text_column(const ObExpr &expr, ObEvalCtx &ctx, ObSQLSessionInfo *session,
+                                common::ObIAllocator &alloc, ObOutputPackInfo *extra_info,
+                                share::schema::ObSchemaGetterGuard *schema_guard,
+                                const common::ObCharsetType result_charset,
+                                const ObBitVector &skip, const int64_t batch_size,
+                                const int64_t column_idx, TextColumnBuf &column);
   static int reset_bitmap(char *result_buffer, const int64_t len,
                           const int64_t column_num, int64_t &pos, char *&bitmap);
   static int convert_string_value_charset(common::ObObj &value,
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/expr/ob_expr_string_kernel.h"
+#include "storage/ob_storage_util.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+typedef const char *(*StringFindFunc)(const char *text, const int64_t text_len,
+                                      const char *pat, const int64_t pat_len);
+typedef bool (*StringIsAsciiFunc)(const char *str, const int64_t len);
+typedef void (*StringCaseFunc)(const char *src, const int64_t len, char *dst);
+
+extern const char *string_find_simd(const char *text, const int64_t text_len,
+                                    const char *pat, const int64_t pat_len);
+extern const char *string_find_ascii_ci_simd(const char *text, const int64_t text_len,
+                                             const char *pat, const int64_t pat_len);
+extern bool string_is_ascii_simd(const char *str, const int64_t len);
+extern void string_ascii_tolower_simd(const char *src, const int64_t len, char *dst);
+extern void string_ascii_toupper_simd(const char *src, const int64_t len, char *dst);
+
+static OB_INLINE char ascii_lower(const char c)
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+}
+
+static OB_INLINE char ascii_upper(const char c)
+{
+  return (c >= 'a' && c <= 'z') ? static_cast<char>(c & ~0x20) : c;
+}
+
+const char *string_find_normal(const char *text, const int64_t text_len,
+                               const char *pat, const int64_t pat_len)
+{
+  return static_cast<const char *>(MEMMEM(text, text_len, pat, pat_len));
+}
+
+const char *string_find_ascii_ci_normal(const char *text, const int64_t text_len,
+                                        const char *pat, const int64_t pat_len)
+{
+  const char *res = NULL;
+  if (0 == pat_len) {
+    res = text;
+  } else if (text_len >= pat_len) {
+    const char first = ascii_lower(pat[0]);
+    for (int64_t i = 0; NULL == res && i + pat_len <= text_len; i++) {
+      if (ascii_lower(text[i]) == first
+          && ObExprStringKernel::ascii_ci_equal(text + i + 1, pat + 1, pat_len - 1)) {
+        res = text + i;
+      }
+    }
+  }
+  return res;
+}
+
+bool string_is_ascii_normal(const char *str, const int64_t len)
+{
+  return storage::is_ascii_str(str, len);
+}
+
+void string_ascii_tolower_normal(const char *src, const int64_t len, char *dst)
+{
+  for (int64_t i = 0; i < len; i++) {
+    dst[i] = ascii_lower(src[i]);
+  }
+}
+
+void string_ascii_toupper_normal(const char *src, const int64_t len, char *dst)
+{
+  for (int64_t i = 0; i < len; i++) {
+    dst[i] = ascii_upper(src[i]);
+  }
+}
+
+static const bool string_kernel_use_simd = blocksstable::is_avx512_valid();
+static const StringFindFunc string_find_func =
+    string_kernel_use_simd ? string_find_simd : string_find_normal;
+static const StringFindFunc string_find_ascii_ci_func =
+    string_kernel_use_simd ? string_find_ascii_ci_simd : string_find_ascii_ci_normal;
+static const StringIsAsciiFunc string_is_ascii_func =
+    string_kernel_use_simd ? string_is_ascii_simd : string_is_ascii_normal;
+static const StringCaseFunc string_ascii_tolower_func =
+    string_kernel_use_simd ? string_ascii_tolower_simd : string_ascii_tolower_normal;
+static const StringCaseFunc string_ascii_toupper_func =
+    string_kernel_use_simd ? string_ascii_toupper_simd : string_ascii_toupper_normal;
+
+const char *ObExprStringKernel::find(const char *text, const int64_t text_len,
+                                     const char *pat, const int64_t pat_len)
+{
+  return string_find_func(text, text_len, pat, pat_len);
+}
+
+const char *ObExprStringKernel::find_ascii_ci(const char *text, const int64_t text_len,
+                                              const char *pat, const int64_t pat_len)
+{
+  return string_find_ascii_ci_func(text, text_len, pat, pat_len);
+}
+
+bool ObExprStringKernel::is_ascii(const char *str, const int64_t len)
+{
+  return string_is_ascii_func(str, len);
+}
+
+void ObExprStringKernel::ascii_tolower(const char *src, const int64_t len, char *dst)
+{
+  string_ascii_tolower_func(src, len, dst);
+}
+
+void ObExprStringKernel::ascii_toupper(const char *src, const int64_t len, char *dst)
+{
+  string_ascii_toupper_func(src, len, dst);
+}
+
+bool ObExprStringKernel::ascii_ci_equal(const char *l, const char *r, const int64_t len)
+{
+  bool equal = true;
+  for (int64_t i = 0; equal && i < len; i++) {
+    equal = ascii_lower(l[i]) == ascii_lower(r[i]);
+  }
+  return equal;
+}
+
+uint32_t ObExprStringKernel::locate(const ObCollationType cs_type,
+                                    const char *text, const int64_t text_len,
+                                    const char *pat, const int64_t pat_len,
+                                    const int64_t pos)
+{
+  uint32_t idx = 0;
+  const bool is_ci = CS_TYPE_UTF8MB4_GENERAL_CI == cs_type;
+  // chars are bytes for binary, and for ASCII text of utf8mb4_bin.
+  // Non-ASCII chars of utf8mb4_general_ci may be equal to ASCII chars (e.g. 'É' and 'e'), so
+  // the pattern must be ASCII too.
+  if (CS_TYPE_BINARY == cs_type
+      || (CS_TYPE_UTF8MB4_BIN == cs_type && is_ascii(text, text_len))
+      || (is_ci && is_ascii(text, text_len) && is_ascii(pat, pat_len))) {
+    const int64_t start = pos - 1;
+    if (start < 0 || start > text_len || start + pat_len > text_len) {
+      idx = 0;
+    } else if (0 == pat_len) {
+      idx = static_cast<uint32_t>(start + 1);
+    } else {
+      const char *found = is_ci
+          ? find_ascii_ci(text + start, text_len - start, pat, pat_len)
+          : find(text + start, text_len - start, pat, pat_len);
+      idx = NULL == found ? 0 : static_cast<uint32_t>(found - text + 1);
+    }
+  } else {
+    idx = ObCharset::locate(cs_type, text, text_len, pat, pat_len, pos);
+  }
+  return idx;
+}
+
+int64_t ObExprStringKernel::strlen_char(const ObCollationType cs_type,
+                                        const char *str, const int64_t len)
+{
+  int64_t char_len = 0;
+  if (storage::can_do_ascii_optimize(cs_type) && is_ascii(str, len)) {
+    char_len = len;
+  } else {
+    char_len = static_cast<int64_t>(ObCharset::strlen_char(cs_type, str, len));
+  }
+  return char_len;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_EXPR_OB_EXPR_STRING_KERNEL_H_
+#define OCEANBASE_EXPR_OB_EXPR_STRING_KERNEL_H_
+
+#include "lib/ob_define.h"
+#include "lib/charset/ob_charset.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Byte string kernels shared by LIKE, LOCATE/INSTR/POSITION, LOWER/UPPER, SUBSTR and
+// CHAR_LENGTH. The AVX2 versions (ob_expr_string_kernel_simd.cpp) are built in the ob_sql_simd
+// target with AVX512 flags, so they are chosen at startup only if the CPU supports AVX512,
+// otherwise the scalar versions are used.
+class ObExprStringKernel
+{
+public:
+  // Same as memmem(): return the first occurrence of %pat in %text, or NULL if not found.
+  static const char *find(const char *text, const int64_t text_len,
+                          const char *pat, const int64_t pat_len);
+  // ASCII case-insensitive version of find(), only letters of ASCII are folded.
+  static const char *find_ascii_ci(const char *text, const int64_t text_len,
+                                   const char *pat, const int64_t pat_len);
+  static bool is_ascii(const char *str, const int64_t len);
+  // Case conversion of ASCII string, %dst may be the same as %src.
+  static void ascii_tolower(const char *src, const int64_t len, char *dst);
+  static void ascii_toupper(const char *src, const int64_t len, char *dst);
+  static bool ascii_ci_equal(const char *l, const char *r, const int64_t len);
+
+  // Same as ObCharset::locate(), the chars of ASCII strings are compared directly for
+  // binary, utf8mb4_bin and utf8mb4_general_ci.
+  static uint32_t locate(const common::ObCollationType cs_type,
+                         const char *text, const int64_t text_len,
+                         const char *pat, const int64_t pat_len,
+                         const int64_t pos);
+  // Same as ObCharset::strlen_char(), with ASCII fast path.
+  static int64_t strlen_char(const common::ObCollationType cs_type,
+                             const char *str, const int64_t len);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_EXPR_OB_EXPR_STRING_KERNEL_H_
@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace oceanbase
+{
+namespace sql
+{
+
+#if defined(__x86_64__)
+static const int64_t STRING_VEC_SIZE = sizeof(__m256i);
+
+static inline char ascii_lower(const char c)
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+}
+
+// mask of the bytes in [lo, hi], bytes >= 0x80 are negative and never in range
+static inline __m256i ascii_case_mask(const __m256i v, const char lo, const char hi)
+{
+  return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(static_cast<char>(lo - 1))),
+                          _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi + 1)), v));
+}
+
+static inline __m256i ascii_lower_vec(const __m256i v)
+{
+  return _mm256_or_si256(v, _mm256_and_si256(ascii_case_mask(v, 'A', 'Z'),
+                                             _mm256_set1_epi8(0x20)));
+}
+
+static inline bool ascii_ci_equal(const char *l, const char *r, const int64_t len)
+{
+  bool equal = true;
+  for (int64_t i = 0; equal && i < len; i++) {
+    equal = ascii_lower(l[i]) == ascii_lower(r[i]);
+  }
+  return equal;
+}
+
+// Substring search with first and last byte filtering: compare 32 candidate positions with
+// the first and the last byte of the pattern at once, and verify only the positions both
+// bytes match.
+template <bool CASE_INSENSITIVE>
+static inline const char *string_find_vec(const char *text, const int64_t text_len,
+                                          const char *pat, const int64_t pat_len,
+                                          int64_t &pos)
+{
+  const char *res = NULL;
+  const char first_c = CASE_INSENSITIVE ? ascii_lower(pat[0]) : pat[0];
+  const char last_c = CASE_INSENSITIVE ? ascii_lower(pat[pat_len - 1]) : pat[pat_len - 1];
+  const __m256i first = _mm256_set1_epi8(first_c);
+  const __m256i last = _mm256_set1_epi8(last_c);
+  pos = 0;
+  for (; NULL == res && pos + pat_len - 1 + STRING_VEC_SIZE <= text_len; pos += STRING_VEC_SIZE) {
+    __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text + pos));
+    __m256i block_last = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(text + pos + pat_len - 1));
+    if (CASE_INSENSITIVE) {
+      block_first = ascii_lower_vec(block_first);
+      block_last = ascii_lower_vec(block_last);
+    }
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                         _mm256_cmpeq_epi8(last, block_last))));
+    while (0 != mask && NULL == res) {
+      const int64_t off = pos + __builtin_ctz(mask);
+      if (CASE_INSENSITIVE
+          ? ascii_ci_equal(text + off + 1, pat + 1, pat_len - 2)
+          : 0 == memcmp(text + off + 1, pat + 1, pat_len - 2)) {
+        res = text + off;
+      }
+      mask &= mask - 1;
+    }
+  }
+  return res;
+}
+#endif
+
+const char *string_find_simd(const char *text, const int64_t text_len,
+                             const char *pat, const int64_t pat_len)
+{
+#if defined(__x86_64__)
+  const char *res = NULL;
+  int64_t pos = 0;
+  if (pat_len >= 2 && text_len >= pat_len + STRING_VEC_SIZE) {
+    res = string_find_vec<false>(text, text_len, pat, pat_len, pos);
+  }
+  if (NULL == res) {
+    res = static_cast<const char *>(memmem(text + pos, text_len - pos, pat, pat_len));
+  }
+  return res;
+#else
+  (void)text;
+  (void)text_len;
+  (void)pat;
+  (void)pat_len;
+  abort();
+  return NULL;
+#endif
+}
+
+const char *string_find_ascii_ci_simd(const char *text, const int64_t text_len,
+                                      const char *pat, const int64_t pat_len)
+{
+#if defined(__x86_64__)
+  const char *res = NULL;
+  int64_t pos = 0;
+  if (0 == pat_len) {
+    res = text;
+  } else {
+    if (pat_len >= 2 && text_len >= pat_len + STRING_VEC_SIZE) {
+      res = string_find_vec<true>(text, text_len, pat, pat_len, pos);
+    }
+    const char first = ascii_lower(pat[0]);
+    for (; NULL == res && pos + pat_len <= text_len; pos++) {
+      if (ascii_lower(text[pos]) == first && ascii_ci_equal(text + pos + 1, pat + 1, pat_len - 1)) {
+        res = text + pos;
+      }
+    }
+  }
+  return res;
+#else
+  (void)text;
+  (void)text_len;
+  (void)pat;
+  (void)pat_len;
+  abort();
+  return NULL;
+#endif
+}
+
+bool string_is_ascii_simd(const char *str, const int64_t len)
+{
+#if defined(__x86_64__)
+  bool is_ascii = true;
+  int64_t pos = 0;
+  for (; is_ascii && pos + STRING_VEC_SIZE <= len; pos += STRING_VEC_SIZE) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + pos));
+    is_ascii = 0 == _mm256_movemask_epi8(v);
+  }
+  for (; is_ascii && pos < len; pos++) {
+    is_ascii = 0 == (str[pos] & 0x80);
+  }
+  return is_ascii;
+#else
+  (void)str;
+  (void)len;
+  abort();
+  return false;
+#endif
+}
+
+#if defined(__x86_64__)
+// flip case of the ASCII letters in [lo, hi]
+template <char LO, char HI>
+static inline void string_ascii_case_vec(const char *src, const int64_t len, char *dst)
+{
+  const __m256i flip = _mm256_set1_epi8(0x20);
+  int64_t pos = 0;
+  for (; pos + STRING_VEC_SIZE <= len; pos += STRING_VEC_SIZE) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + pos));
+    const __m256i mask = ascii_case_mask(v, LO, HI);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + pos),
+                        _mm256_xor_si256(v, _mm256_and_si256(mask, flip)));
+  }
+  for (; pos < len; pos++) {
+    const char c = src[pos];
+    dst[pos] = (c >= LO && c <= HI) ? static_cast<char>(c ^ 0x20) : c;
+  }
+}
+#endif
+
+void string_ascii_tolower_simd(const char *src, const int64_t len, char *dst)
+{
+#if defined(__x86_64__)
+  string_ascii_case_vec<'A', 'Z'>(src, len, dst);
+#else
+  (void)src;
+  (void)len;
+  (void)dst;
+  abort();
+#endif
+}
+
+void string_ascii_toupper_simd(const char *src, const int64_t len, char *dst)
+{
+#if defined(__x86_64__)
+  string_ascii_case_vec<'a', 'z'>(src, len, dst);
+#else
+  (void)src;
+  (void)len;
+  (void)dst;
+  abort();
+#endif
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -20,6 +20,7 @@
 #include "sql/session/ob_sql_session_info.h"
 #include "storage/ob_storage_util.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_string_kernel.h"
 
 namespace oceanbase
 {
@@ -439,7 +440,7 @@ int ObExprSubstr::substr(common::ObString &varchar,
     } else {
       if (do_ascii_optimize_check) { // ObCharsetType is CHARSET_UTF8MB4 or CHARSET_GBK
         res_len = min(length, varchar.length() - start);
-        is_ascii = storage::is_ascii_str(varchar.ptr(), start + res_len);
+        is_ascii = ObExprStringKernel::is_ascii(varchar.ptr(), start + res_len);
       }
       if (is_ascii) {
         varchar.assign_ptr(varchar.ptr() + start, static_cast<int32_t>(res_len));
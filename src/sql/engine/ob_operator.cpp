@@ -18,6 +18,7 @@
 #include "sql/engine/ob_exec_context.h"
 #include "common/ob_smart_call.h"
 #include "sql/monitor/ob_sql_plan_manager.h"
+#include "sql/engine/expr/ob_expr_filter_kernel.h"
 
 namespace oceanbase
 {
@@ -483,7 +484,8 @@ ObOperator::ObOperator(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput
     batch_reach_end_(false),
     row_reach_end_(false),
     output_batches_b4_rescan_(0),
-    check_stack_overflow_(false)
+    check_stack_overflow_(false),
+    enable_fused_filter_kernel_(false)
 {
   eval_ctx_.max_batch_size_ = spec.max_batch_size_;
   eval_ctx_.batch_size_ = spec.max_batch_size_;
@@ -624,6 +626,8 @@ int ObOperator::open()
       */
       eval_ctx_.set_batch_size(1);
       eval_ctx_.set_batch_idx(0);
+    } else {
+      enable_fused_filter_kernel_ = ctx_.get_my_session()->is_enable_fused_filter_kernel();
     }
     if (ctx_.get_my_session()->is_user_session() || spec_.plan_->get_phy_plan_hint().monitor_) {
       IGNORE_RETURN try_register_rt_monitor_node(0);
@@ -1234,7 +1238,16 @@ int ObOperator::filter_batch_rows(const ObExprPtrIArray &exprs,
   all_filtered = false;
   FOREACH_CNT_X(e, exprs, OB_SUCC(ret) && !all_filtered) {
     OB_ASSERT(ob_is_int_tc((*e)->datum_meta_.type_));
-    if (OB_FAIL((*e)->eval_batch(eval_ctx_, skip, bsize))) {
+    ObExprFilterKernelFunc kernel = enable_fused_filter_kernel_
+        ? ObExprFilterKernel::get_kernel(**e, eval_ctx_) : NULL;
+    if (NULL != kernel) {
+      int64_t output_rows = 0;
+      if (OB_FAIL(kernel(**e, eval_ctx_, skip, bsize, output_rows))) {
+        LOG_WARN("fused filter kernel failed", K(ret), K_(eval_ctx));
+      } else {
+        all_filtered = (0 == output_rows);
+      }
+    } else if (OB_FAIL((*e)->eval_batch(eval_ctx_, skip, bsize))) {
       LOG_WARN("evaluate batch failed", K(ret), K_(eval_ctx));
     } else if (!(*e)->is_batch_result()) {
       const ObDatum &d = (*e)->locate_expr_datum(eval_ctx_);
@@ -635,6 +635,8 @@ protected:
   bool row_reach_end_;
   int64_t output_batches_b4_rescan_;
   bool check_stack_overflow_;
+  // tenant config _enable_fused_filter_kernel cached on session, read once at open
+  bool enable_fused_filter_kernel_;
   DISALLOW_COPY_AND_ASSIGN(ObOperator);
 };
 
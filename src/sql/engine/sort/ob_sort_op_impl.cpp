@@ -1988,10 +1988,29 @@ int ObSortOpImpl::add_heap_sort_batch(const common::ObIArray<ObExpr *> &exprs,
   const ObChunkDatumStore::StoredRow *store_row = NULL;
   ObEvalCtx::BatchInfoScopeGuard batch_info_guard(*eval_ctx_);
   batch_info_guard.set_batch_size(batch_size);
+  // Once the heap is full, the first sort key of the heap top is the threshold of the
+  // top-n: rows whose first sort key is behind it can never enter the heap, so they are
+  // pruned with the batch evaluated first sort key, without the row by row comparing.
+  ObExpr *key_expr = NULL;
+  ObDatum *key_datums = NULL;
+  if (OB_NOT_NULL(topn_heap_) && !is_fetch_with_ties_
+      && topn_heap_->count() > 0 && topn_heap_->count() == topn_cnt_ - outputted_rows_cnt_) {
+    key_expr = exprs.at(sort_collations_->at(0).field_idx_);
+    if (OB_FAIL(key_expr->eval_batch(*eval_ctx_, skip, batch_size))) {
+      LOG_WARN("failed to eval batch", K(ret));
+    } else {
+      key_datums = key_expr->locate_batch_datums(*eval_ctx_);
+    }
+  }
   for (int64_t i = start_pos; OB_SUCC(ret) && i < batch_size; i++) {
     if (skip.at(i)) {
       continue;
     }
+    if (NULL != key_datums && is_behind_topn_threshold(
+        key_datums[key_expr->is_batch_result() ? i : 0])) {
+      row_count++;
+      continue;
+    }
     batch_info_guard.set_batch_idx(i);
     if (OB_FAIL(add_heap_sort_row(exprs, store_row))) {
       LOG_WARN("failed to add topn row", K(ret));
@@ -2033,6 +2052,14 @@ int ObSortOpImpl::add_heap_sort_batch(const common::ObIArray<ObExpr *> &exprs,
   return ret;
 }
 
+bool ObSortOpImpl::is_behind_topn_threshold(const ObDatum &key) const
+{
+  const ObSortFieldCollation &sort_collation = sort_collations_->at(0);
+  const ObDatum &threshold = topn_heap_->top()->cells()[sort_collation.field_idx_];
+  const int cmp = sort_cmp_funs_->at(0).cmp_func_(key, threshold);
+  return sort_collation.is_ascending_ ? cmp > 0 : cmp < 0;
+}
+
 int ObSortOpImpl::adjust_topn_heap(const common::ObIArray<ObExpr*> &exprs,
                                    const ObChunkDatumStore::StoredRow *&store_row)
 {
@@ -524,6 +524,8 @@ protected:
                           const int64_t batch_size,
                           const uint16_t selector[],
                           const int64_t size);
+  // first sort key of the row is behind the one of the topn heap top
+  bool is_behind_topn_threshold(const ObDatum &key) const;
   int adjust_topn_heap(const common::ObIArray<ObExpr*> &exprs,
                        const ObChunkDatumStore::StoredRow *&store_row);
   int adjust_topn_heap_with_ties(const common::ObIArray<ObExpr*> &exprs,
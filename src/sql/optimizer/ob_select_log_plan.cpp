@@ -48,6 +48,7 @@
 #include "sql/optimizer/ob_log_link_scan.h"
 #include "common/ob_smart_call.h"
 #include "share/system_variable/ob_sys_var_class_type.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 using namespace oceanbase;
 using namespace sql;
@@ -60,6 +61,10 @@ namespace oceanbase
 {
 namespace sql
 {
+// sort based group by is also tried for three stage aggregation when the group count is at
+// least this ratio of the (group key, distinct param) pair count
+static const double THREE_STAGE_AGGR_NDV_RATIO = 0.5;
+
 ObSelectLogPlan::ObSelectLogPlan(ObOptimizerContext &ctx, const ObSelectStmt *stmt)
     : ObLogPlan(ctx, stmt)
 {
@@ -254,6 +259,27 @@ int ObSelectLogPlan::candi_allocate_normal_group_by(const ObIArray<ObRawExpr*> &
                                                         groupby_helper,
                                                         groupby_plans))) {
           LOG_WARN("failed to candi allocate three stage group by", K(ret));
+        } else if (!groupby_helper.force_use_hash_
+                   && groupby_helper.group_ndv_ >= groupby_helper.group_distinct_ndv_
+                                                   * THREE_STAGE_AGGR_NDV_RATIO) {
+          // The (group key, distinct param) pairs hardly reduce the input rows when almost every
+          // group holds a few distinct values, the pairs deduplicated in hash table of the second
+          // stage are nearly as many as the groups. Let the sort based plan compete by cost.
+          OPT_TRACE("group ndv is close to group distinct ndv, try normal group by",
+                    groupby_helper.group_ndv_, groupby_helper.group_distinct_ndv_);
+          if (OB_FAIL(candi_allocate_normal_group_by(reduce_exprs,
+                                                     group_by_exprs,
+                                                     group_directions,
+                                                     rollup_exprs,
+                                                     rollup_directions,
+                                                     having_exprs,
+                                                     aggr_items,
+                                                     is_from_povit,
+                                                     groupby_helper,
+                                                     false,
+                                                     groupby_plans))) {
+            LOG_WARN("failed to inner allocate normal group by", K(ret));
+          }
         }
     } else if (OB_FAIL(candi_allocate_normal_group_by(reduce_exprs,
                                                       group_by_exprs,
@@ -710,19 +736,39 @@ int ObSelectLogPlan::create_hash_group_plan(const ObIArray<ObRawExpr*> &reduce_e
                                                                      is_partition_wise))) {
     LOG_WARN("failed to check if sharding compatible", K(ret));
   } else if (!top->is_distributed() || is_partition_wise) {
-    if (OB_FAIL(allocate_group_by_as_top(top,
-                                         AggregateAlgo::HASH_AGGREGATE,
-                                         group_by_exprs,
-                                         rollup_exprs,
-                                         aggr_items,
-                                         having_exprs,
-                                         is_from_povit,
-                                         groupby_helper.group_ndv_,
-                                         origin_child_card,
-                                         is_partition_wise))) {
+    bool need_local_push_down = false;
+    ObSEArray<ObRawExpr*, 1> dummy_exprs;
+    if (!is_partition_wise &&
+        OB_FAIL(check_local_group_by_pushdown(rollup_exprs, groupby_helper, top,
+                                              need_local_push_down))) {
+      LOG_WARN("failed to check local group by pushdown", K(ret));
+    } else if (need_local_push_down &&
+               OB_FAIL(allocate_group_by_as_top(top,
+                                                AggregateAlgo::HASH_AGGREGATE,
+                                                group_by_exprs,
+                                                dummy_exprs,
+                                                aggr_items,
+                                                dummy_exprs,
+                                                is_from_povit,
+                                                groupby_helper.group_ndv_,
+                                                origin_child_card,
+                                                false,
+                                                true))) {
+      LOG_WARN("failed to allocate local push down group by as top", K(ret));
+    } else if (OB_FAIL(allocate_group_by_as_top(top,
+                                                AggregateAlgo::HASH_AGGREGATE,
+                                                group_by_exprs,
+                                                rollup_exprs,
+                                                aggr_items,
+                                                having_exprs,
+                                                is_from_povit,
+                                                groupby_helper.group_ndv_,
+                                                origin_child_card,
+                                                is_partition_wise))) {
       LOG_WARN("failed to allocate group by as top", K(ret));
+    } else {
+      static_cast<ObLogGroupBy*>(top)->set_group_by_outline_info(true, need_local_push_down);
     }
-    static_cast<ObLogGroupBy*>(top)->set_group_by_outline_info(true, false);
   } else {
     // allocate push down group by
     if (groupby_helper.can_basic_pushdown_) {
@@ -785,6 +831,42 @@ int ObSelectLogPlan::create_hash_group_plan(const ObIArray<ObRawExpr*> &reduce_e
   return ret;
 }
 
+/*
+ * For a local hash group by, a push down (partial) hash group by is allocated below it if the
+ * final hash table is not expected to fit in cache. The partial group by keeps a cache sized
+ * hash table, flushes it when it is full, and bypasses rows when the reduction ratio is poor
+ * (see ObAdaptiveByPassCtrl), so the final group by gets less rows to build and dump.
+ */
+int ObSelectLogPlan::check_local_group_by_pushdown(const ObIArray<ObRawExpr*> &rollup_exprs,
+                                                   const GroupingOpHelper &groupby_helper,
+                                                   const ObLogicalOperator *top,
+                                                   bool &need_push_down)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session_info = NULL;
+  bool enable_local_partial = false;
+  need_push_down = false;
+  if (OB_ISNULL(top) || OB_ISNULL(session_info = get_optimizer_context().get_session_info())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(top), K(session_info));
+  } else if (!groupby_helper.can_basic_pushdown_ || !rollup_exprs.empty() ||
+             top->is_distributed()) {
+    /* do nothing */
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session_info->get_effective_tenant_id()));
+    if (tenant_config.is_valid()) {
+      enable_local_partial = tenant_config->_enable_local_partial_aggregation;
+    }
+    const double group_size = groupby_helper.group_ndv_ * top->get_width();
+    need_push_down = enable_local_partial &&
+                     group_size > static_cast<double>(get_level3_cache_size()) &&
+                     top->get_card() > groupby_helper.group_ndv_ * LOCAL_PARTIAL_AGGR_MIN_RATIO;
+    LOG_TRACE("check local group by pushdown", K(enable_local_partial), K(group_size),
+              K(groupby_helper.group_ndv_), K(top->get_card()), K(need_push_down));
+  }
+  return ret;
+}
+
 int ObSelectLogPlan::allocate_topk_for_hash_group_plan(ObLogicalOperator *&top)
 {
   int ret = OB_SUCCESS;
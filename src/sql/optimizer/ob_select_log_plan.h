@@ -55,6 +55,9 @@ protected:
   virtual int generate_dblink_raw_plan() override;
 
 private:
+  // minimal child card / group ndv to allocate a push down group by for a local hash group by,
+  // the same as the initial cut ratio of the adaptive bypass
+  static constexpr double LOCAL_PARTIAL_AGGR_MIN_RATIO = 3.0;
   // @brief Allocate a hash group by on top of a plan tree
   // ObLogicalOperator * candi_allocate_hash_group_by();
 
@@ -121,6 +124,11 @@ private:
                              GroupingOpHelper &groupby_helper,
                              ObLogicalOperator *&top);
 
+  int check_local_group_by_pushdown(const ObIArray<ObRawExpr*> &rollup_exprs,
+                                    const GroupingOpHelper &groupby_helper,
+                                    const ObLogicalOperator *top,
+                                    bool &need_push_down);
+
   int allocate_topk_for_hash_group_plan(ObLogicalOperator *&top);
 
   int allocate_topk_sort_as_top(ObLogicalOperator *&top,
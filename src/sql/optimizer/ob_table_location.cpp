@@ -1695,36 +1695,31 @@ int ObTableLocation::get_tablet_locations(ObDASCtx &das_ctx,
       LOG_WARN("Partitoin location list prepare error", K(ret));
     } else {
       ObDASLocationRouter &loc_router = das_ctx.get_location_router();
-      ObLSLocation location;
+      ObSEArray<ObLSLocation, 4> locations;
+      UNUSED(nonblock);
+      //TODO shengle use nonblock after location service support nonblock interface
+      if (N > 0 && OB_FAIL(loc_router.batch_get(loc_meta_, tablet_ids, locations))) {
+        //TODO shengle set partition key for location cache renew
+        LOG_WARN("Get partition error, then set partition key for location cache renew later",
+                 K(ret), K(ref_table_id), K(tablet_ids));
+      } else if (N > 0 && OB_ISNULL(session)) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("invalid argument", K(session), K(ret));
+      }
       for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
-        location.reset();
         ObCandiTabletLoc &candi_tablet_loc = candi_tablet_locs.at(i);
-        if (nonblock) {
-          //TODO shengle use nonblock after location service support nonblock interface
-          ret = loc_router.get(loc_meta_, tablet_ids.at(i), location);
-        } else {
-          ret = loc_router.get(loc_meta_, tablet_ids.at(i), location);
-        }
-        if (OB_FAIL(ret)) {
-          //TODO shengle set partition key for location cache renew
-          LOG_WARN("Get partition error, then set partition key for location cache renew later",
-                   K(ret), K(ref_table_id), "tablet_id", tablet_ids.at(i), K(candi_tablet_loc));
-        } else {
-          if (OB_ISNULL(session)) {
-            ret = OB_INVALID_ARGUMENT;
-            LOG_WARN("invalid argument", K(session), K(ret));
-          } else if (OB_FAIL(candi_tablet_loc.set_part_loc_with_only_readable_replica(
-                                      partition_ids.at(i),
-                                      tablet_ids.at(i), location,
-                                      session->get_retry_info().get_invalid_servers()))) {
-            LOG_WARN("fail to set partition location with only readable replica",
-                     K(ret),K(i), K(location), K(candi_tablet_locs), K(tablet_ids), K(partition_ids),
-                     K(session->get_retry_info().get_invalid_servers()));
-          }
-          LOG_TRACE("set partition location with only readable replica",
+        const ObLSLocation &location = locations.at(i);
+        if (OB_FAIL(candi_tablet_loc.set_part_loc_with_only_readable_replica(
+                                    partition_ids.at(i),
+                                    tablet_ids.at(i), location,
+                                    session->get_retry_info().get_invalid_servers()))) {
+          LOG_WARN("fail to set partition location with only readable replica",
                    K(ret),K(i), K(location), K(candi_tablet_locs), K(tablet_ids), K(partition_ids),
                    K(session->get_retry_info().get_invalid_servers()));
         }
+        LOG_TRACE("set partition location with only readable replica",
+                 K(ret),K(i), K(location), K(candi_tablet_locs), K(tablet_ids), K(partition_ids),
+                 K(session->get_retry_info().get_invalid_servers()));
       } // for end
     }
   }
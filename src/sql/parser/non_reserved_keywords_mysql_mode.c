@@ -46,6 +46,8 @@ static const NonReservedKeyword Mysql_none_reserved_keywords[] =
   {"approx_count_distinct", APPROX_COUNT_DISTINCT},
   {"approx_count_distinct_synopsis", APPROX_COUNT_DISTINCT_SYNOPSIS},
   {"approx_count_distinct_synopsis_merge", APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE},
+  {"approx_median", APPROX_MEDIAN},
+  {"approx_percentile", APPROX_PERCENTILE},
   {"arbitration", ARBITRATION},
   {"archivelog", ARCHIVELOG},
   {"as", AS},
@@ -61,6 +61,9 @@ inline const char *ob_aggr_func_str(ObItemType aggr_func)
     case T_FUN_APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE:
       ret = "APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE";
       break;
+    case T_FUN_APPROX_PERCENTILE:
+      ret = "APPROX_PERCENTILE";
+      break;
     case T_FUN_VARIANCE:
       ret = "VARIANCE";
       break;
@@ -244,6 +244,7 @@ END_P SET_VAR DELIMITER
 %token <non_reserved_keyword>
         ACCESS ACCOUNT ACTION ACTIVE ADDDATE AFTER AGAINST AGGREGATE ALGORITHM ALWAYS ANALYSE ANY
         APPROX_COUNT_DISTINCT APPROX_COUNT_DISTINCT_SYNOPSIS APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE
+        APPROX_MEDIAN APPROX_PERCENTILE
         ARBITRATION ASCII AT AUTHORS AUTO AUTOEXTEND_SIZE AUTO_INCREMENT AUTO_INCREMENT_MODE AVG AVG_ROW_LENGTH
         ACTIVATE AVAILABILITY ARCHIVELOG AUDIT
 
@@ -2204,6 +2205,14 @@ MOD '(' expr ',' expr ')'
 {
   malloc_non_terminal_node($$, result->malloc_pool_, T_FUN_APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE, 1, $3);
 }
+| APPROX_PERCENTILE '(' expr ',' expr ')'
+{
+  malloc_non_terminal_node($$, result->malloc_pool_, T_FUN_APPROX_PERCENTILE, 2, $3, $5);
+}
+| APPROX_MEDIAN '(' expr ')'
+{
+  malloc_non_terminal_node($$, result->malloc_pool_, T_FUN_APPROX_PERCENTILE, 1, $3);
+}
 | SUM '(' opt_distinct_or_all expr ')'
 {
   malloc_non_terminal_node($$, result->malloc_pool_, T_FUN_SUM, 2, $3, $4);
@@ -16586,6 +16595,8 @@ ACCOUNT
 |       APPROX_COUNT_DISTINCT
 |       APPROX_COUNT_DISTINCT_SYNOPSIS
 |       APPROX_COUNT_DISTINCT_SYNOPSIS_MERGE
+|       APPROX_MEDIAN
+|       APPROX_PERCENTILE
 |       ARCHIVELOG
 |       ARBITRATION
 |       ASCII
@@ -1746,6 +1746,34 @@ int ObRawExprDeduceType::visit(ObAggFunRawExpr &expr)
         }
         break;
       }
+      case T_FUN_APPROX_PERCENTILE: {
+        ObRawExpr *child_expr = NULL;
+        ObRawExpr *percentile_expr = NULL;
+        if (OB_UNLIKELY(2 != expr.get_real_param_count())) {
+          ret = OB_ERR_PARAM_SIZE;
+          LOG_WARN("invalid number of arguments", K(ret), K(expr.get_real_param_count()));
+        } else if (OB_ISNULL(child_expr = expr.get_param_expr(0)) ||
+                   OB_ISNULL(percentile_expr = expr.get_param_expr(1))) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("param expr is null", K(ret), K(expr));
+        } else if (OB_UNLIKELY(ob_is_geometry(child_expr->get_data_type()))) {
+          ret = OB_INVALID_ARGUMENT;
+          LOG_WARN("Incorrect geometry arguments", K(child_expr->get_data_type()), K(ret));
+        } else if (!percentile_expr->is_const_expr()) {
+          ret = OB_ERR_ARGUMENT_SHOULD_CONSTANT;
+          LOG_WARN("Argument should be a constant.", K(ret));
+        } else {
+          // both the value and the percentile are calculated in double
+          need_add_cast = true;
+          result_type.set_double();
+          result_type.set_scale(ObAccuracy(PRECISION_UNKNOWN_YET, SCALE_UNKNOWN_YET).get_scale());
+          result_type.set_precision(
+                            ObAccuracy(PRECISION_UNKNOWN_YET, SCALE_UNKNOWN_YET).get_precision());
+          expr.set_result_type(result_type);
+          expr.unset_result_flag(NOT_NULL_FLAG);
+        }
+        break;
+      }
       case T_FUN_HYBRID_HIST: {
         ObRawExpr *param_expr1 = NULL;
         ObRawExpr *param_expr2 = NULL;
@@ -1002,6 +1002,8 @@ int ObRawExprPrinter::print(ObAggFunRawExpr *expr)
       SET_SYMBOL_IF_EMPTY("median");
     case T_FUN_APPROX_COUNT_DISTINCT:
       SET_SYMBOL_IF_EMPTY("approx_count_distinct");
+    case T_FUN_APPROX_PERCENTILE:
+      SET_SYMBOL_IF_EMPTY("approx_percentile");
     case T_FUN_GROUPING:
       SET_SYMBOL_IF_EMPTY("grouping");
     case T_FUN_GROUPING_ID:
@@ -705,6 +705,7 @@ int ObRawExprResolverImpl::do_recursive_resolve(const ParseNode *node, ObRawExpr
       case T_FUN_WM_CONCAT:
       case T_FUN_TOP_FRE_HIST:
       case T_FUN_HYBRID_HIST:
+      case T_FUN_APPROX_PERCENTILE:
       case T_FUN_SYS_BIT_AND:
       case T_FUN_SYS_BIT_OR:
       case T_FUN_SYS_BIT_XOR:
@@ -3856,6 +3857,34 @@ int ObRawExprResolverImpl::process_agg_node(const ParseNode *node, ObRawExpr *&e
       } else if (OB_FAIL(agg_expr->add_real_param_expr(sub_expr))) {
         LOG_WARN("fail to add param expr", K(ret));
       }
+    } else if (T_FUN_APPROX_PERCENTILE == node->type_) {
+      // APPROX_MEDIAN(expr) is resolved as APPROX_PERCENTILE(expr, 0.5)
+      ObRawExpr *percentile_expr = NULL;
+      ObConstRawExpr *median_expr = NULL;
+      sub_expr = NULL;
+      if (OB_UNLIKELY(1 != node->num_child_ && 2 != node->num_child_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("get unexpected error, node expected 1 or 2 arguments", K(ret),
+                 K(node->num_child_));
+      } else if (OB_FAIL(SMART_CALL(recursive_resolve(node->children_[0], sub_expr)))) {
+        LOG_WARN("fail to recursive resolve node child", K(ret));
+      } else if (OB_FAIL(agg_expr->add_real_param_expr(sub_expr))) {
+        LOG_WARN("fail to add param expr", K(ret));
+      } else if (2 == node->num_child_) {
+        if (OB_FAIL(SMART_CALL(recursive_resolve(node->children_[1], percentile_expr)))) {
+          LOG_WARN("fail to recursive resolve node child", K(ret));
+        }
+      } else if (OB_FAIL(ObRawExprUtils::build_const_double_expr(ctx_.expr_factory_,
+                                                                 ObDoubleType,
+                                                                 0.5,
+                                                                 median_expr))) {
+        LOG_WARN("failed to build const double expr", K(ret));
+      } else {
+        percentile_expr = median_expr;
+      }
+      if (OB_SUCC(ret) && OB_FAIL(agg_expr->add_real_param_expr(percentile_expr))) {
+        LOG_WARN("fail to add param expr", K(ret));
+      }
     } else if (T_FUN_CORR == node->type_ || T_FUN_COVAR_POP == node->type_ ||
                T_FUN_COVAR_SAMP == node->type_ || T_FUN_REGR_SLOPE == node->type_  ||
                T_FUN_REGR_INTERCEPT == node->type_ || T_FUN_REGR_COUNT == node->type_ ||
@@ -2326,6 +2326,8 @@ void ObSQLSessionInfo::ObCachedTenantConfigInfo::refresh()
       px_join_skew_minfreq_ = tenant_config->_px_join_skew_minfreq;
       // 7. print_sample_ppm_ for flt
       ATOMIC_STORE(&print_sample_ppm_, tenant_config->_print_sample_ppm);
+      // 8. fused filter kernels of vectorized execution
+      enable_fused_filter_kernel_ = tenant_config->_enable_fused_filter_kernel;
     }
     //timezone的更新频率非常低，放到后台驱动
     (void)session_->update_timezone_info();
@@ -23,6 +23,7 @@
 #include "lib/ob_name_def.h"
 #include "lib/oblog/ob_warning_buffer.h"
 #include "lib/list/ob_list.h"
+#include "lib/list/ob_dlink_node.h"
 #include "lib/allocator/page_arena.h"
 #include "lib/objectpool/ob_pool.h"
 #include "lib/time/ob_cur_time.h"
@@ -492,6 +493,7 @@ public:
                                  at_type_(ObAuditTrailType::NONE),
                                  sort_area_size_(128*1024*1024),
                                  print_sample_ppm_(0),
+                                 enable_fused_filter_kernel_(false),
                                  last_check_ec_ts_(0),
                                  session_(session)
     {
@@ -507,6 +509,7 @@ public:
     int64_t get_print_sample_ppm() const { return ATOMIC_LOAD(&print_sample_ppm_); }
     bool get_px_join_skew_handling() const { return px_join_skew_handling_; }
     int64_t get_px_join_skew_minfreq() const { return px_join_skew_minfreq_; }
+    bool get_enable_fused_filter_kernel() const { return enable_fused_filter_kernel_; }
   private:
     //租户级别配置项缓存session 上，避免每次获取都需要刷新
     bool is_external_consistent_;
@@ -520,6 +523,7 @@ public:
     int64_t sort_area_size_;
     // for record sys config print_sample_ppm
     int64_t print_sample_ppm_;
+    bool enable_fused_filter_kernel_;
     int64_t last_check_ec_ts_;
     ObSQLSessionInfo *session_;
   };
@@ -805,6 +809,10 @@ public:
   int restore_sql_session(StmtSavedValue &saved_value);
   int restore_session(StmtSavedValue &saved_value);
   ObExecContext *get_cur_exec_ctx() { return cur_exec_ctx_; }
+  // link in the per-cpu session shard of ObSQLSessionMgr, protected by the shard lock
+  common::ObDLinkNode<ObSQLSessionInfo *> &get_shard_node() { return shard_node_; }
+  int64_t get_shard_idx() const { return shard_idx_; }
+  void set_shard_idx(const int64_t shard_idx) { shard_idx_ = shard_idx; }
 
   int begin_nested_session(StmtSavedValue &saved_value, bool skip_cur_stmt_tables = false);
   int end_nested_session(StmtSavedValue &saved_value);
@@ -981,6 +989,11 @@ public:
     cached_tenant_config_info_.refresh();
     return cached_tenant_config_info_.get_print_sample_ppm();
   }
+  bool is_enable_fused_filter_kernel()
+  {
+    cached_tenant_config_info_.refresh();
+    return cached_tenant_config_info_.get_enable_fused_filter_kernel();
+  }
   int get_tmp_table_size(uint64_t &size);
   int ps_use_stream_result_set(bool &use_stream);
   void set_proxy_version(uint64_t v) { proxy_version_ = v; }
@@ -1204,6 +1217,8 @@ private:
   // This situation is unexpected and will report a warning to user.
   bool group_id_not_expected_;
   ObOptimizerTraceImpl optimizer_tracer_;
+  common::ObDLinkNode<ObSQLSessionInfo *> shard_node_;
+  int64_t shard_idx_ = -1; // -1 means not linked in any shard
 };
 
 inline bool ObSQLSessionInfo::is_terminate(int &ret) const
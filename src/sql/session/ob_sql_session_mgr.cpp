@@ -17,6 +17,7 @@
 #include "lib/stat/ob_session_stat.h"
 #include "lib/mysqlclient/ob_mysql_proxy.h"
 #include "lib/utility/ob_tracepoint.h"
+#include "lib/thread_local/ob_tsi_utils.h"
 #include "share/inner_table/ob_inner_table_schema_constants.h"
 #include "share/ob_resource_limit.h"
 #include "io/easy_io.h"
@@ -235,6 +236,7 @@ void ObSQLSessionMgr::ValueAlloc::free_value(ObSQLSessionInfo *session)
                                                     reinterpret_cast<uint64_t>(session)))) {
       LOG_WARN("fail to erase session", K(session->get_sessid()), K(tmp_ret), KP(session));
     }
+    GCTX.session_mgr_->remove_from_session_shard(*session);
     if (is_valid_tenant_id(tenant_id) && session->can_release_to_pool()) {
       if (session->is_use_inner_allocator() && !session->is_tenant_killed()) {
         OX (session_pool_map_.get_session_pool(tenant_id, session_pool));
@@ -418,11 +420,33 @@ int ObSQLSessionMgr::create_session(const uint64_t tenant_id,
       tmp_sess->set_flt_control_info(mgr.get_control_info());
     }
     tmp_sess->update_last_active_time();
+    add_to_session_shard(*tmp_sess);
     session_info = tmp_sess;
   }
   return ret;
 }
 
+void ObSQLSessionMgr::add_to_session_shard(ObSQLSessionInfo &sess_info)
+{
+  const int64_t shard_idx = MAX(icpu_id(), 0) % SESSION_SHARD_CNT;
+  SessionShard &shard = session_shards_[shard_idx];
+  ObSpinLockGuard guard(shard.lock_);
+  sess_info.get_shard_node().get_data() = &sess_info;
+  shard.list_.add_last(&sess_info.get_shard_node());
+  sess_info.set_shard_idx(shard_idx);
+}
+
+void ObSQLSessionMgr::remove_from_session_shard(ObSQLSessionInfo &sess_info)
+{
+  const int64_t shard_idx = sess_info.get_shard_idx();
+  if (shard_idx >= 0 && shard_idx < SESSION_SHARD_CNT) {
+    SessionShard &shard = session_shards_[shard_idx];
+    ObSpinLockGuard guard(shard.lock_);
+    shard.list_.remove(&sess_info.get_shard_node());
+    sess_info.set_shard_idx(-1);
+  }
+}
+
 int ObSQLSessionMgr::free_session(const ObFreeSessionCtx &ctx)
 {
   int ret = OB_SUCCESS;
@@ -15,6 +15,7 @@
 
 #include "lib/hash/ob_concurrent_hash_map.h"
 #include "lib/container/ob_concurrent_bitset.h"
+#include "lib/list/ob_dlist.h"
 #include "sql/session/ob_sql_session_info.h"
 #include "sql/ob_end_trans_callback.h"
 namespace oceanbase
@@ -97,6 +98,9 @@ public:
    */
   void revert_session(ObSQLSessionInfo *sess_info);
 
+  void add_to_session_shard(ObSQLSessionInfo &sess_info);
+  void remove_from_session_shard(ObSQLSessionInfo &sess_info);
+
   /**
    * @brief use the function to traverse all session
    * @param fn : it can be a pointer of the function or function object
@@ -107,6 +111,15 @@ public:
   template <typename Function>
   int for_each_hold_session(Function &fn);
 
+  /**
+   * @brief traverse all sessions of the map through the per-cpu session shards.
+   *        Only one shard is locked at a time and no reference is taken on the
+   *        sessions, so request threads are not disturbed by the traversal.
+   *        fn must be cheap and must not get or revert sessions.
+   */
+  template <typename Function>
+  int for_each_session_in_shards(Function &fn);
+
   int kill_query(ObSQLSessionInfo &session);
   int set_query_deadlocked(ObSQLSessionInfo &session);
   static int kill_query(ObSQLSessionInfo &session,
@@ -283,6 +296,16 @@ private:
   uint32_t first_seq_;
   uint32_t increment_sessid_;
   SessionMap sess_hold_map_;
+  // sessions of sessinfo_map_ are also linked in the shard of the cpu creating them,
+  // a session is unlinked before it is freed or returned to the session pool.
+  static const int64_t SESSION_SHARD_CNT = 64;
+  struct SessionShard
+  {
+    SessionShard() : lock_(common::ObLatchIds::SQL_SESSION_SHARD_LOCK), list_() {}
+    common::ObSpinLock lock_;
+    common::ObDList<common::ObDLinkNode<ObSQLSessionInfo *>> list_;
+  } CACHE_ALIGNED;
+  SessionShard session_shards_[SESSION_SHARD_CNT];
   DISALLOW_COPY_AND_ASSIGN(ObSQLSessionMgr);
 }; // end of class ObSQLSessionMgr
 
@@ -298,6 +321,23 @@ int ObSQLSessionMgr::for_each_hold_session(Function &fn)
   return get_sess_hold_map().foreach_refactored(fn);
 }
 
+template <typename Function>
+int ObSQLSessionMgr::for_each_session_in_shards(Function &fn)
+{
+  int ret = common::OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < SESSION_SHARD_CNT; ++i) {
+    SessionShard &shard = session_shards_[i];
+    common::ObSpinLockGuard guard(shard.lock_);
+    DLIST_FOREACH(node, shard.list_) {
+      ObSQLSessionInfo *sess_info = node->get_data();
+      if (!fn(Key(sess_info->get_sessid(), sess_info->get_proxy_sessid()), sess_info)) {
+        ret = common::OB_EAGAIN;
+      }
+    }
+  }
+  return ret;
+}
+
 inline int ObSQLSessionMgr::get_session(uint32_t sessid, ObSQLSessionInfo *&sess_info)
 {
   int ret = sessinfo_map_.get(Key(sessid), sess_info);
@@ -29,6 +29,7 @@
 #include "sql/engine/expr/ob_expr_lob_utils.h"
 #include "storage/ob_tenant_tablet_stat_mgr.h"
 #include "storage/tablet/ob_tablet.h"
+#include "common/ob_smart_call.h"
 
 namespace oceanbase
 {
@@ -64,6 +65,9 @@ ObMultipleMerge::ObMultipleMerge()
       block_row_store_(nullptr),
       out_project_cols_(),
       lob_reader_(),
+      filter_projector_(nullptr),
+      filter_col_exprs_(),
+      filter_cols_project_(),
       scan_state_(ScanState::NONE)
 {
 }
@@ -89,6 +93,13 @@ ObMultipleMerge::~ObMultipleMerge()
     }
     iter_pool_ = nullptr;
   }
+  if (nullptr != filter_projector_) {
+    filter_projector_->~ObRow2ExprsProjector();
+    if (OB_NOT_NULL(access_ctx_->stmt_allocator_)) {
+      access_ctx_->stmt_allocator_->free(filter_projector_);
+    }
+    filter_projector_ = nullptr;
+  }
 }
 
 int ObMultipleMerge::init(
@@ -158,6 +169,8 @@ int ObMultipleMerge::init(
       }
     }
     if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(init_filter_projector(param, context))) {
+      STORAGE_LOG(WARN, "fail to init filter projector", K(ret));
     } else if (OB_FAIL(prepare_read_tables())) {
       STORAGE_LOG(WARN, "fail to prepare read tables", K(ret));
     } else if (OB_FAIL(alloc_row_store(context, param))) {
@@ -671,8 +684,14 @@ int ObMultipleMerge::process_fuse_row(const bool not_using_static_engine,
   int ret = OB_SUCCESS;
   bool need_skip = false;
   bool is_filter_filtered = false;
+  bool is_filter_checked = false;
   out_row = nullptr;
-  if (OB_FAIL((not_using_static_engine)
+  if (nullptr != filter_projector_ && !not_using_static_engine && !in_row.fast_filter_skipped_
+      && OB_FAIL(filter_before_project(in_row, is_filter_filtered, is_filter_checked))) {
+    LOG_WARN("fail to filter row before project", K(ret));
+  } else if (is_filter_filtered) {
+    LOG_DEBUG("store row is filtered before project", K(in_row));
+  } else if (OB_FAIL((not_using_static_engine)
           ?  project_row(in_row,
                          access_param_->iter_param_.out_cols_project_,
                          range_idx_delta_,
@@ -695,10 +714,11 @@ int ObMultipleMerge::process_fuse_row(const bool not_using_static_engine,
   } else if (need_fill_virtual_columns_ && OB_FAIL(fill_virtual_columns(cur_row_))) {
     LOG_WARN("Fail to fill virtual columns, ", K(ret));
   }
-  if (OB_FAIL(ret) || need_skip) {
+  if (OB_FAIL(ret) || need_skip || is_filter_filtered) {
   } else{
     if (in_row.fast_filter_skipped_) {
       in_row.fast_filter_skipped_ = false;
+    } else if (is_filter_checked) {
     } else if (OB_FAIL(check_filtered(cur_row_, is_filter_filtered))) {
       LOG_WARN("fail to check row filtered", K(ret));
     }
@@ -747,6 +767,15 @@ void ObMultipleMerge::reset()
     }
     iter_pool_ = nullptr;
   }
+  if (nullptr != filter_projector_) {
+    filter_projector_->~ObRow2ExprsProjector();
+    if (OB_NOT_NULL(access_ctx_->stmt_allocator_)) {
+      access_ctx_->stmt_allocator_->free(filter_projector_);
+    }
+    filter_projector_ = nullptr;
+  }
+  filter_col_exprs_.reset();
+  filter_cols_project_.reset();
   padding_allocator_.reset();
   iters_.reset();
   access_param_ = NULL;
@@ -1072,6 +1101,109 @@ int ObMultipleMerge::check_filtered(const ObDatumRow &row, bool &filtered)
   return ret;
 }
 
+int ObMultipleMerge::init_filter_projector(const ObTableAccessParam &param,
+                                           ObTableAccessContext &context)
+{
+  int ret = OB_SUCCESS;
+  bool can_filter_first = true;
+  ObSEArray<int64_t, 8> filter_col_idxs;
+  filter_col_exprs_.reuse();
+  filter_cols_project_.reuse();
+  if (NULL == param.op_ || NULL == param.output_exprs_ || NULL == param.op_filters_
+      || param.op_filters_->empty() || need_padding_ || need_fill_virtual_columns_) {
+    // padded and virtual columns are filled after projection, check filters after them
+  } else {
+    const sql::ObExprPtrIArray &output_exprs = *param.output_exprs_;
+    for (int64_t i = 0; OB_SUCC(ret) && can_filter_first && i < param.op_filters_->count(); i++) {
+      if (OB_ISNULL(param.op_filters_->at(i))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected null filter", K(ret), K(i));
+      } else if (OB_FAIL(collect_filter_columns(*param.op_filters_->at(i), output_exprs,
+                                                filter_col_idxs, can_filter_first))) {
+        LOG_WARN("fail to collect filter columns", K(ret), K(i));
+      }
+    }
+    // filter columns are projected twice for the rows passed, only worth it if the filters
+    // use a small part of the output columns.
+    if (OB_FAIL(ret) || !can_filter_first || filter_col_idxs.count() * 2 > output_exprs.count()) {
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < filter_col_idxs.count(); i++) {
+        const int64_t idx = filter_col_idxs.at(i);
+        if (OB_FAIL(filter_col_exprs_.push_back(output_exprs.at(idx)))) {
+          LOG_WARN("fail to push back filter column", K(ret));
+        } else if (OB_FAIL(filter_cols_project_.push_back(param.iter_param_.out_cols_project_->at(idx)))) {
+          LOG_WARN("fail to push back filter column project", K(ret));
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_ISNULL(filter_projector_ = OB_NEWx(ObRow2ExprsProjector,
+                                                       context.stmt_allocator_,
+                                                       *context.stmt_allocator_))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to alloc filter projector", K(ret));
+      } else if (OB_FAIL(filter_projector_->init(filter_col_exprs_, *param.op_, filter_cols_project_))) {
+        LOG_WARN("fail to init filter projector", K(ret));
+      }
+      LOG_TRACE("init filter projector", K(ret), K(filter_cols_project_), K(output_exprs.count()));
+    }
+  }
+  return ret;
+}
+
+int ObMultipleMerge::collect_filter_columns(const sql::ObExpr &expr,
+                                            const sql::ObExprPtrIArray &output_exprs,
+                                            ObIArray<int64_t> &filter_col_idxs,
+                                            bool &can_filter_first)
+{
+  int ret = OB_SUCCESS;
+  int64_t idx = -1;
+  for (int64_t i = 0; idx < 0 && i < output_exprs.count(); i++) {
+    if (output_exprs.at(i) == &expr) {
+      idx = i;
+    }
+  }
+  if (idx >= 0) {
+    // lob columns may need lob locator filled after projection
+    if (expr.arg_cnt_ > 0 || out_project_cols_.at(idx).col_type_.is_lob_storage()) {
+      can_filter_first = false;
+    } else if (OB_FAIL(add_var_to_array_no_dup(filter_col_idxs, idx))) {
+      LOG_WARN("fail to add filter column", K(ret), K(idx));
+    }
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && can_filter_first && i < expr.arg_cnt_; i++) {
+      if (OB_ISNULL(expr.args_[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected null arg", K(ret), K(i));
+      } else if (OB_FAIL(SMART_CALL(collect_filter_columns(*expr.args_[i], output_exprs,
+                                                           filter_col_idxs, can_filter_first)))) {
+        LOG_WARN("fail to collect filter columns", K(ret), K(i));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMultipleMerge::filter_before_project(const ObDatumRow &in_row,
+                                           bool &filtered,
+                                           bool &filter_checked)
+{
+  int ret = OB_SUCCESS;
+  int64_t nop_cnt = 0;
+  filtered = false;
+  filter_checked = false;
+  if (OB_FAIL(filter_projector_->project(filter_col_exprs_, in_row.storage_datums_,
+                                         nop_pos_.nops_, nop_cnt))) {
+    LOG_WARN("fail to project filter columns", K(ret), K(in_row));
+  } else if (0 != nop_cnt) {
+    // default values of filter columns are fused after the whole row is projected
+  } else if (OB_FAIL(check_filtered(in_row, filtered))) {
+    LOG_WARN("fail to check row filtered", K(ret));
+  } else {
+    filter_checked = true;
+  }
+  return ret;
+}
+
 int ObMultipleMerge::add_iterator(ObStoreRowIterator &iter)
 {
   int ret = OB_SUCCESS;
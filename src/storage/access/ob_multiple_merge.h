@@ -35,6 +35,7 @@ namespace oceanbase
 namespace storage
 {
 class ObBlockRowStore;
+class ObRow2ExprsProjector;
 class ObMultipleMerge : public ObQueryRowIterator
 {
 public:
@@ -102,6 +103,14 @@ private:
   int save_curr_rowkey();
   int reset_tables();
   int check_filtered(const blocksstable::ObDatumRow &row, bool &filtered);
+  int init_filter_projector(const ObTableAccessParam &param, ObTableAccessContext &context);
+  int collect_filter_columns(const sql::ObExpr &expr,
+                             const sql::ObExprPtrIArray &output_exprs,
+                             common::ObIArray<int64_t> &filter_col_idxs,
+                             bool &can_filter_first);
+  int filter_before_project(const blocksstable::ObDatumRow &in_row,
+                            bool &filtered,
+                            bool &filter_checked);
   int alloc_row_store(ObTableAccessContext &context, const ObTableAccessParam &param);
   int alloc_iter_pool(common::ObIAllocator &allocator);
   int process_fuse_row(const bool not_using_static_engine,
@@ -143,6 +152,11 @@ protected:
   ObBlockRowStore *block_row_store_;
   common::ObSEArray<share::schema::ObColDesc, 32> out_project_cols_;
   ObLobDataReader lob_reader_;
+  // Late materialization of merged rows: the columns of the filters are projected and the
+  // filters are checked first, the other output columns are projected for the rows that pass.
+  ObRow2ExprsProjector *filter_projector_;
+  common::ObSEArray<sql::ObExpr *, 8> filter_col_exprs_;
+  common::ObSEArray<int32_t, 8> filter_cols_project_;
 private:
   enum ScanState
   {
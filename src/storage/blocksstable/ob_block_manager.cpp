@@ -1397,7 +1397,8 @@ int ObBlockManager::InspectBadBlockTask::check_block(const MacroBlockId &macro_i
 
 static inline int64_t get_disk_allowed_iops(const int64_t macro_block_size)
 {
-  const int64_t max_bkgd_band_width = 64 * 1024 * 1024;
+  // inspection runs once per second, so the bandwidth limit is also the limit of one round
+  const int64_t max_bkgd_band_width = GCONF._data_verify_io_bandwidth;
   const int64_t max_check_iops = max_bkgd_band_width / macro_block_size;
   return max_check_iops;
 }
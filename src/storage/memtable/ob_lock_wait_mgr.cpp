@@ -18,6 +18,7 @@
 #include "lib/rowid/ob_urowid.h"
 #include "lib/utility/ob_macro_utils.h"
 #include "observer/ob_server.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "share/deadlock/ob_deadlock_detector_mgr.h"
 #include "lib/function/ob_function.h"
 #include "lib/hash/ob_linear_hash_map.h"
@@ -96,6 +97,7 @@ bool is_rowkey_hash(const uint64_t hash)
 
 ObLockWaitMgr::ObLockWaitMgr()
     : is_inited_(false),
+      enable_handoff_(false),
       hash_(hash_buf_, sizeof(hash_buf_)),
       deadlocked_sessions_lock_(common::ObLatchIds::DEADLOCK_DETECT_LOCK),
       deadlocked_sessions_index_(0)
@@ -120,6 +122,7 @@ int ObLockWaitMgr::init()
     TRANS_LOG(WARN, "can't init row_holder", KR(ret));
   } else {
     share::ObThreadPool::set_run_wrapper(MTL_CTX());
+    refresh_handoff_config_();
     is_inited_ = true;
   }
   TRANS_LOG(INFO, "LockWaitMgr.init", K(ret));
@@ -171,9 +174,22 @@ void RowHolderMapper::reset_hash_holder(const ObTabletID &tablet_id,
   }
 }
 
+void ObLockWaitMgr::refresh_handoff_config_()
+{
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    const bool enable_handoff = tenant_config->_enable_lock_wait_handoff;
+    if (enable_handoff != is_handoff_enabled_()) {
+      ATOMIC_STORE(&enable_handoff_, enable_handoff);
+      TRANS_LOG(INFO, "LockWaitMgr handoff mode changed", K(enable_handoff));
+    }
+  }
+}
+
 void ObLockWaitMgr::run1()
 {
   int64_t last_dump_ts = 0;
+  int64_t last_refresh_ts = 0;
   int64_t now = 0;
   lib::set_thread_name("LockWaitMgr");
   while(!has_set_stop() || !is_hash_empty()) {
@@ -185,6 +201,10 @@ void ObLockWaitMgr::run1()
     }
     // dump debug info, and check deadlock enabdle, clear mapper if deadlock is disabled
     now = ObClockGenerator::getCurrentTime();
+    if (now - last_refresh_ts > 1_s) {
+      last_refresh_ts = now;
+      refresh_handoff_config_();
+    }
     if (now - last_dump_ts > 5_s) {
       last_dump_ts = now;
       row_holder_mapper_.dump_mapper_info();
@@ -205,14 +225,29 @@ int64_t ObLockWaitMgr::get_wait_lock_timeout(int64_t timeout)
   return new_timeout;
 }
 
+void ObLockWaitMgr::on_row_locked(const ObTabletID &tablet_id, const Key &key)
+{
+  uint64_t &handoff_key = get_thread_handoff_key();
+  if (OB_UNLIKELY(0 != handoff_key) && handoff_key == hash_rowkey(tablet_id, key)) {
+    get_thread_handoff_locked() = true;
+  }
+}
+
 bool ObLockWaitMgr::post_process(bool need_retry, bool& need_wait)
 {
   bool wait_succ = false;
   Node* node = get_thread_node();
   if (node != nullptr) {
     uint64_t &hold_key = get_thread_hold_key();
+    const uint64_t handoff_key = get_thread_handoff_key();
     need_wait = false;
-    if (0 != hold_key) {
+    if (0 == hold_key) {
+      // nothing to wakeup
+    } else if (!need_retry && hold_key == handoff_key && get_thread_handoff_locked()) {
+      // the request handed the row in handoff mode has locked it, the next
+      // waiter of the row is woken by the commit or abort of its transaction
+      TRANS_LOG(TRACE, "LockWaitMgr.handoff_hold", K(hold_key));
+    } else {
       wakeup(hold_key);
     }
     if (need_retry) {
@@ -351,19 +386,89 @@ void ObLockWaitMgr::wakeup(uint64_t hash)
 {
   TRANS_LOG(TRACE, "LockWaitMgr.wakeup.start", K(hash));
   Node *node = NULL;
-  do {
-    node = fetch_waiter(hash);
+  if (!is_rowkey_hash(hash) && is_handoff_enabled_()) {
+    handoff_wakeup_(hash);
+  } else {
+    do {
+      node = fetch_waiter(hash);
+
+      if (NULL != node) {
+        EVENT_INC(MEMSTORE_WRITE_LOCK_WAKENUP_COUNT);
+        EVENT_ADD(MEMSTORE_WAIT_WRITE_LOCK_TIME, ObTimeUtility::current_time() - node->lock_ts_);
+        if (is_rowkey_hash(hash) && is_handoff_enabled_()) {
+          // the row is handed to the first waiter, the next one is woken by its
+          // commit or abort if it locks the row, otherwise by the end of the request
+          node->on_handoff_lock(hash);
+        } else {
+          node->on_retry_lock(hash);
+        }
+        (void)repost(node);
+      }
+      // continue loop to wake up all requests waitting on the transaction.
+      // or continue loop to wake up all requests waitting on the tablelock.
+    } while (!is_rowkey_hash(hash) && node != NULL);
+  }
+  TRANS_LOG(TRACE, "LockWaitMgr.wakeup.done", K(hash));
+}
 
-    if (NULL != node) {
+void ObLockWaitMgr::handoff_wakeup_(uint64_t hash)
+{
+  int ret = OB_SUCCESS;
+  Node *node = NULL;
+  HandoffRowArray handed_rows;
+  int64_t wakeup_cnt = 0;
+  int64_t requeue_cnt = 0;
+  while (NULL != (node = fetch_waiter(hash))) {
+    const uint64_t row_hash = node->origin_hash_;
+    bool need_repost = true;
+    if (is_rowkey_hash(row_hash) && row_hash != hash) {
+      // the waiter was transferred from a row to this transaction, the row
+      // can only be acquired by one of them, so the first waiter (in FIFO
+      // order) takes it and the others queue up on the row again
+      if (!has_exist_in_array(handed_rows, row_hash)) {
+        if (OB_FAIL(handed_rows.push_back(row_hash))) {
+          TRANS_LOG(WARN, "push back handed row failed", K(ret), K(row_hash));
+          ret = OB_SUCCESS;
+        }
+      } else {
+        node->change_hash(row_hash, get_seq(row_hash));
+        change_detector_to_row(node, row_hash);
+        if (wait(node)) {
+          // remove the repeated calculations
+          node->try_lock_times_--;
+          need_repost = false;
+          requeue_cnt++;
+        }
+      }
+    }
+    if (need_repost) {
       EVENT_INC(MEMSTORE_WRITE_LOCK_WAKENUP_COUNT);
       EVENT_ADD(MEMSTORE_WAIT_WRITE_LOCK_TIME, ObTimeUtility::current_time() - node->lock_ts_);
-      node->on_retry_lock(hash);
+      if (is_rowkey_hash(row_hash)) {
+        // once the woken request locks the row, the next waiter of the row is
+        // woken by the commit or abort of its transaction, otherwise by the
+        // end of the request
+        node->on_handoff_lock(row_hash);
+      } else {
+        node->on_retry_lock(hash);
+      }
       (void)repost(node);
+      wakeup_cnt++;
     }
-    // continue loop to wake up all requests waitting on the transaction.
-    // or continue loop to wake up all requests waitting on the tablelock.
-  } while (!is_rowkey_hash(hash) && node != NULL);
-  TRANS_LOG(TRACE, "LockWaitMgr.wakeup.done", K(hash));
+  }
+  TRANS_LOG(TRACE, "LockWaitMgr.handoff_wakeup", K(hash), K(wakeup_cnt), K(requeue_cnt));
+}
+
+void ObLockWaitMgr::change_detector_to_row(Node *node, const uint64_t row_hash)
+{
+  if (OB_LIKELY(ObDeadLockDetectorMgr::is_deadlock_enabled())) {
+    // undo change_detector_waiting_obj_from_row_to_trans, the waiter depends
+    // on whoever holds the row from now on
+    ObTransID self_tx_id(node->tx_id_);
+    DeadLockBlockCallBack deadlock_block_call_back(row_holder_mapper_, row_hash);
+    (void)ObTransDeadlockDetectorAdapter::change_detector_waiting_obj_from_trans_to_row(self_tx_id,
+                                                                                        deadlock_block_call_back);
+  }
 }
 
 ObLockWaitMgr::Node* ObLockWaitMgr::next(Node*& iter, Node* target)
@@ -186,6 +186,7 @@ public:
 public:
   enum { LOCK_BUCKET_COUNT = 16384};
   static const int64_t OB_SESSPAIR_COUNT = 16;
+  static const int64_t OB_HANDOFF_ROW_COUNT = 16;
   typedef ObMemtableKey Key;
   typedef rpc::ObLockWaitNode Node;
   typedef FixedHash2<Node> Hash;
@@ -194,6 +195,7 @@ public:
     TO_STRING_KV(K(sess_id_));
   };
   typedef ObSEArray<SessPair, OB_SESSPAIR_COUNT> DeadlockedSessionArray;
+  typedef ObSEArray<uint64_t, OB_HANDOFF_ROW_COUNT> HandoffRowArray;
 
 public:
   ObLockWaitMgr();
@@ -216,11 +218,19 @@ public:
     node.recv_ts_ = recv_ts;
     get_thread_node() = &node;
     get_thread_hold_key() = node.hold_key_;
+    get_thread_handoff_key() = node.is_handoff_ ? node.hold_key_ : 0;
+    get_thread_handoff_locked() = false;
     node.hold_key_ = 0;
+    node.is_handoff_ = false;
   }
   // clear the local variable, thread_node. NB: we should wakeup the reqyest
   // based on the thread_key, because the key for the request may be changed
-  static void clear_thread_node() { get_thread_node() = nullptr; }
+  static void clear_thread_node()
+  {
+    get_thread_node() = nullptr;
+    get_thread_handoff_key() = 0;
+    get_thread_handoff_locked() = false;
+  }
   // When the request ends, the thread worker will check whether the retry is
   // needed. And if so, it will push the request into the lock_wait_mgr based on
   // whether request encounters a conflict and needs to retry
@@ -260,6 +270,9 @@ public:
   // wakeup the request waiting on the tablelock.
   void wakeup(const transaction::tablelock::ObLockID &lock_id);
   // for deadlock
+  // called when the request locks a row, the request which is handed the row
+  // in handoff mode leaves waking up the next waiter to its commit or abort
+  void on_row_locked(const ObTabletID &tablet_id, const Key &key);
   DELEGATE_WITH_RET(row_holder_mapper_, set_hash_holder, void);
   DELEGATE_WITH_RET(row_holder_mapper_, reset_hash_holder, void);
   
@@ -281,12 +294,21 @@ protected:
   void retire_node(ObLink*& tail, Node* node);
   // wakeup the request and put into the thread worker queue
   virtual int repost(Node* node);
+  // the waiter transferred to the transaction is parked back on the row in
+  // handoff mode, make it depend on the row holder in deadlock detector
+  virtual void change_detector_to_row(Node *node, const uint64_t row_hash);
 
 private:
   int64_t get_wait_lock_timeout(int64_t timeout);
   bool wait(Node* node);
   Node* get(uint64_t hash);
   void wakeup(uint64_t hash);
+  // wakeup the requests waiting on the transaction in handoff mode: only the
+  // first waiter of each row is reposted, the others are parked back on the
+  // row they originally conflicted on and keep their FIFO position there
+  void handoff_wakeup_(uint64_t hash);
+  void refresh_handoff_config_();
+  bool is_handoff_enabled_() const { return ATOMIC_LOAD(&enable_handoff_); }
 private:
 
   static uint64_t& get_thread_hold_key()
@@ -295,6 +317,18 @@ private:
     return hold_key;
   }
 
+  static uint64_t& get_thread_handoff_key()
+  {
+    RLOCAL_INLINE(uint64_t, handoff_key);
+    return handoff_key;
+  }
+
+  static bool& get_thread_handoff_locked()
+  {
+    RLOCAL_INLINE(bool, handoff_locked);
+    return handoff_locked;
+  }
+
   ObQSync& get_qs()
   {
     static ObQSync qsync;
@@ -329,6 +363,9 @@ private:
 
 private:
   bool is_inited_;
+  // whether the releasing side hands the row off to exactly one waiter,
+  // refreshed from _enable_lock_wait_handoff by the background thread
+  bool enable_handoff_;
   Hash hash_;
   int64_t sequence_[LOCK_BUCKET_COUNT];
   char hash_buf_[sizeof(SpHashNode) * LOCK_BUCKET_COUNT];
@@ -2731,6 +2731,7 @@ int ObMemtable::mvcc_write_(storage::ObStoreCtx &ctx,
         TRANS_LOG(WARN, "lock wait mgr is null", K(ret));
       } else {
         p_lock_wait_mgr->set_hash_holder(key_.get_tablet_id(), *key, mem_ctx->get_tx_id());
+        p_lock_wait_mgr->on_row_locked(key_.get_tablet_id(), *key);
       }
     }
     /***********************/
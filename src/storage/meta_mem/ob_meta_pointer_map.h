@@ -84,6 +84,11 @@ private:
       ObMetaPointerHandle<Key, T> &ptr_hdl,
       ObMetaObjGuard<T> &guard,
       bool &is_in_memory);
+  // Gets the value store of key without increasing its handle reference count. The
+  // caller must hold the bucket lock of key, which keeps the value store from being freed.
+  int get_value_store_without_lock(
+      const Key &key,
+      ObResourceValueStore<ObMetaPointer<T>> *&value_store);
   int erase(const Key &key);
 public:
   using ObResourceMap<Key, ObMetaPointer<T>>::ObResourceMap;
@@ -106,6 +111,7 @@ public:
 
   TO_STRING_KV("ptr", ObResourceHandle<ObMetaPointer<T>>::ptr_, KP_(map));
 private:
+  friend class ObMetaPointerMap<Key, T>;
   int set(
       ObResourceValueStore<ObMetaPointer<T>> *ptr,
       ObMetaPointerMap<Key, T> *map);
@@ -260,7 +266,7 @@ template <typename Key, typename T>
 int ObMetaPointerMap<Key, T>::exist(const Key &key, bool &is_exist)
 {
   int ret = common::OB_SUCCESS;
-  ObMetaPointerHandle<Key, T> ptr_hdl(*this);
+  ObResourceValueStore<ObMetaPointer<T>> *value_store = nullptr;
   ObMetaPointer<T> *t_ptr = nullptr;
   is_exist = false;
   if (OB_UNLIKELY(!ResourceMap::is_inited_)) {
@@ -271,13 +277,13 @@ int ObMetaPointerMap<Key, T>::exist(const Key &key, bool &is_exist)
     STORAGE_LOG(WARN, "invalid argument", K(ret), K(key));
   } else {
     common::ObBucketHashRLockGuard lock_guard(ResourceMap::bucket_lock_, ResourceMap::hash_func_(key));
-    if (OB_FAIL(ResourceMap::get_without_lock(key, ptr_hdl))) {
+    if (OB_FAIL(get_value_store_without_lock(key, value_store))) {
       if (OB_ENTRY_NOT_EXIST == ret) {
         ret = common::OB_SUCCESS;
       } else {
         STORAGE_LOG(WARN, "fail to get pointer handle", K(ret));
       }
-    } else if (OB_ISNULL(t_ptr = ptr_hdl.get_resource_ptr())) {
+    } else if (OB_ISNULL(t_ptr = value_store->get_value_ptr())) {
       ret = common::OB_ERR_UNEXPECTED;
       STORAGE_LOG(WARN, "fail to get meta pointer", K(ret), KP(t_ptr));
     } else {
@@ -294,7 +300,7 @@ int ObMetaPointerMap<Key, T>::try_get_in_memory_meta_obj_and_addr(
     ObMetaObjGuard<T> &guard)
 {
   int ret = common::OB_SUCCESS;
-  ObMetaPointerHandle<Key, T> ptr_hdl(*this);
+  ObResourceValueStore<ObMetaPointer<T>> *value_store = nullptr;
   ObMetaPointer<T> *t_ptr = nullptr;
   guard.reset();
   if (OB_UNLIKELY(!key.is_valid())) {
@@ -302,11 +308,11 @@ int ObMetaPointerMap<Key, T>::try_get_in_memory_meta_obj_and_addr(
     STORAGE_LOG(WARN, "invalid argument", K(ret), K(key));
   } else { // read lock
     common::ObBucketHashRLockGuard lock_guard(ResourceMap::bucket_lock_, ResourceMap::hash_func_(key));
-    if (OB_FAIL(ResourceMap::get_without_lock(key, ptr_hdl))) {
+    if (OB_FAIL(get_value_store_without_lock(key, value_store))) {
       if (common::OB_ENTRY_NOT_EXIST != ret) {
         STORAGE_LOG(WARN, "fail to get pointer handle", K(ret), K(key));
       }
-    } else if (OB_ISNULL(t_ptr = ptr_hdl.get_resource_ptr())) {
+    } else if (OB_ISNULL(t_ptr = value_store->get_value_ptr())) {
       ret = common::OB_ERR_UNEXPECTED;
       STORAGE_LOG(WARN, "fail to get meta pointer", K(ret), KP(t_ptr), K(key));
     } else if (t_ptr->is_in_memory() && OB_FAIL(t_ptr->get_in_memory_obj(guard))) {
@@ -325,7 +331,7 @@ int ObMetaPointerMap<Key, T>::try_get_in_memory_meta_obj(
     ObMetaObjGuard<T> &guard)
 {
   int ret = common::OB_SUCCESS;
-  ObMetaPointerHandle<Key, T> ptr_hdl(*this);
+  ObResourceValueStore<ObMetaPointer<T>> *value_store = nullptr;
   ObMetaPointer<T> *t_ptr = nullptr;
   guard.reset();
   success = false;
@@ -335,11 +341,11 @@ int ObMetaPointerMap<Key, T>::try_get_in_memory_meta_obj(
     STORAGE_LOG(WARN, "invalid argument", K(ret), K(key));
   } else { // read lock
     common::ObBucketHashRLockGuard lock_guard(ResourceMap::bucket_lock_, ResourceMap::hash_func_(key));
-    if (OB_FAIL(ResourceMap::get_without_lock(key, ptr_hdl))) {
+    if (OB_FAIL(get_value_store_without_lock(key, value_store))) {
       if (common::OB_ENTRY_NOT_EXIST != ret) {
         STORAGE_LOG(WARN, "fail to get pointer handle", K(ret), K(key));
       }
-    } else if (OB_ISNULL(t_ptr = ptr_hdl.get_resource_ptr())) {
+    } else if (OB_ISNULL(t_ptr = value_store->get_value_ptr())) {
       ret = common::OB_ERR_UNEXPECTED;
       STORAGE_LOG(WARN, "fail to get meta pointer", K(ret), KP(t_ptr), K(key));
     } else if (t_ptr->is_in_memory()) {
@@ -361,13 +367,14 @@ int ObMetaPointerMap<Key, T>::try_get_in_memory_meta_obj(
     bool &is_in_memory)
 {
   int ret = OB_SUCCESS;
+  ObResourceValueStore<ObMetaPointer<T>> *value_store = nullptr;
   ObMetaPointer<T> *t_ptr = nullptr;
   common::ObBucketHashRLockGuard lock_guard(ResourceMap::bucket_lock_, ResourceMap::hash_func_(key));
-  if (OB_FAIL(ResourceMap::get_without_lock(key, ptr_hdl))) {
+  if (OB_FAIL(get_value_store_without_lock(key, value_store))) {
     if (common::OB_ENTRY_NOT_EXIST != ret) {
       STORAGE_LOG(WARN, "fail to get pointer handle", K(ret));
     }
-  } else if (OB_ISNULL(t_ptr = ptr_hdl.get_resource_ptr())) {
+  } else if (OB_ISNULL(t_ptr = value_store->get_value_ptr())) {
     ret = common::OB_ERR_UNEXPECTED;
     STORAGE_LOG(WARN, "fail to get meta pointer", K(ret), KP(t_ptr), K(key));
   } else if (OB_UNLIKELY(t_ptr->get_addr().is_none())) {
@@ -375,13 +382,42 @@ int ObMetaPointerMap<Key, T>::try_get_in_memory_meta_obj(
     STORAGE_LOG(DEBUG, "pointer addr is none, no object to be got", K(ret), K(key), KPC(t_ptr));
   } else {
     is_in_memory = t_ptr->is_in_memory();
-    if (is_in_memory && OB_FAIL(t_ptr->get_in_memory_obj(guard))) {
-      STORAGE_LOG(WARN, "fail to get meta object", K(ret), KP(t_ptr), K(key));
+    if (is_in_memory) {
+      if (OB_FAIL(t_ptr->get_in_memory_obj(guard))) {
+        STORAGE_LOG(WARN, "fail to get meta object", K(ret), KP(t_ptr), K(key));
+      }
+    // the pointer handle is only needed to load the object, the in-memory path doesn't touch
+    // the reference count of the pointer shared by all readers of the same key.
+    } else if (OB_FAIL(ptr_hdl.set(value_store, this))) {
+      STORAGE_LOG(WARN, "fail to set pointer handle", K(ret), K(key));
     }
   }
   return ret;
 }
 
+template <typename Key, typename T>
+int ObMetaPointerMap<Key, T>::get_value_store_without_lock(
+    const Key &key,
+    ObResourceValueStore<ObMetaPointer<T>> *&value_store)
+{
+  int ret = common::OB_SUCCESS;
+  value_store = nullptr;
+  if (OB_UNLIKELY(!ResourceMap::is_inited_)) {
+    ret = common::OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObResourceMap has not been inited", K(ret));
+  } else if (OB_FAIL(ResourceMap::map_.get_refactored(key, value_store))) {
+    if (common::OB_HASH_NOT_EXIST != ret) {
+      STORAGE_LOG(WARN, "fail to get from map", K(ret), K(key));
+    } else {
+      ret = common::OB_ENTRY_NOT_EXIST;
+    }
+  } else if (OB_ISNULL(value_store)) {
+    ret = common::OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "value store is null", K(ret), K(key));
+  }
+  return ret;
+}
+
 template <typename Key, typename T>
 int ObMetaPointerMap<Key, T>::get_meta_obj(
     const Key &key,
@@ -153,6 +153,8 @@ int ObTenantCheckpointSlogHandler::replay_checkpoint_and_slog(const ObTenantSupe
   int ret = OB_SUCCESS;
   const ObMemAttr mem_attr(MTL_ID(), "TenantReplay");
   const int64_t replay_tablet_cnt = 10003;
+  const int64_t start_time = ObTimeUtility::current_time();
+  int64_t ckpt_finish_time = start_time;
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     LOG_WARN("ObTenantCheckpointSlogHandler not init", K(ret));
@@ -160,6 +162,7 @@ int ObTenantCheckpointSlogHandler::replay_checkpoint_and_slog(const ObTenantSupe
     LOG_WARN("fail to create replay map", K(ret));
   } else if (OB_FAIL(replay_checkpoint(super_block))) {
     LOG_WARN("fail to read_ls_checkpoint", K(ret), K(super_block));
+  } else if (FALSE_IT(ckpt_finish_time = ObTimeUtility::current_time())) {
   } else if (OB_FAIL(replay_tenant_slog(super_block.replay_start_point_))) {
     LOG_WARN("fail to replay_tenant_slog", K(ret));
   } else if (OB_FAIL(MTL(ObLSService*)->gc_ls_after_replay_slog())) {
@@ -167,6 +170,9 @@ int ObTenantCheckpointSlogHandler::replay_checkpoint_and_slog(const ObTenantSupe
   } else {
     replay_tablet_disk_addr_map_.destroy();
   }
+  LOG_INFO("finish replay tenant checkpoint and slog", K(ret),
+      "ckpt_cost_us", ckpt_finish_time - start_time,
+      "total_cost_us", ObTimeUtility::current_time() - start_time);
   return ret;
 }
 
@@ -240,7 +246,7 @@ int ObTenantCheckpointSlogHandler::replay_tablet(
   } else if (OB_FAIL(replay_tablet_disk_addr_map_.set_refactored(map_key, addr, 0/*should not exist*/))) {
     LOG_WARN("update tablet meta addr fail", K(ret), K(map_key), K(addr));
   } else {
-    LOG_INFO("Successfully load tablet ckpt", K(map_key), K(addr));
+    LOG_DEBUG("Successfully load tablet ckpt", K(map_key), K(addr));
   }
 
   return ret;
@@ -255,6 +261,9 @@ int ObTenantCheckpointSlogHandler::replay_tenant_slog(const common::ObLogCursor
   log_file_spec.retry_write_policy_ = "normal";
   log_file_spec.log_create_policy_ = "normal";
   log_file_spec.log_write_policy_ = "truncate";
+  const int64_t start_time = ObTimeUtility::current_time();
+  int64_t replay_finish_time = start_time;
+  int64_t load_finish_time = start_time;
 
   if (OB_FAIL(replayer.init(MTL(ObStorageLogger *)->get_dir(), log_file_spec))) {
     LOG_WARN("fail to init slog replayer", K(ret));
@@ -263,15 +272,19 @@ int ObTenantCheckpointSlogHandler::replay_tenant_slog(const common::ObLogCursor
     LOG_WARN("fail to register redo module", K(ret));
   } else if (OB_FAIL(replayer.replay(start_point, replay_finish_point, MTL_ID()))) {
     LOG_WARN("fail to replay tenant slog", K(ret));
+  } else if (FALSE_IT(replay_finish_time = ObTimeUtility::current_time())) {
   } else if (OB_FAIL(replay_load_tablets())) {
     LOG_WARN("fail to replay load tablets", K(ret));
+  } else if (FALSE_IT(load_finish_time = ObTimeUtility::current_time())) {
   } else if (OB_FAIL(replayer.replay_over())) {
     LOG_WARN("fail to replay over", K(ret));
   } else if (OB_FAIL(MTL(ObStorageLogger *)->start_log(replay_finish_point))) {
     LOG_WARN("fail to start_slog", K(ret), K(replay_finish_point));
   }
 
-  LOG_INFO("finish replay tenant slog", K(ret), K(start_point), K(replay_finish_point));
+  LOG_INFO("finish replay tenant slog", K(ret), K(start_point), K(replay_finish_point),
+      "replay_cost_us", replay_finish_time - start_time,
+      "load_tablet_cost_us", load_finish_time - replay_finish_time);
 
   return ret;
 }
@@ -279,11 +292,8 @@ int ObTenantCheckpointSlogHandler::replay_tenant_slog(const common::ObLogCursor
 int ObTenantCheckpointSlogHandler::replay_load_tablets()
 {
   int ret = OB_SUCCESS;
-  const ObMemAttr mem_attr(MTL_ID(), "TenantReplay");
   char *buf = nullptr;
   int64_t buf_len = 0;
-  char *r_buf = nullptr;
-  int64_t r_len = 0;
   ObArray<ObTabletMapKey> tablets;
   ReplayTabletDiskAddrMap::iterator iter = replay_tablet_disk_addr_map_.begin();
   while (OB_SUCC(ret) && iter != replay_tablet_disk_addr_map_.end()) {
@@ -315,49 +325,121 @@ int ObTenantCheckpointSlogHandler::replay_load_tablets()
       return ret;
     });
   }
+  // inner tablets are loaded first and in order, the user tablets are independent of each
+  // other and loaded in parallel if there are many of them.
+  int64_t inner_tablet_cnt = 0;
   for (int64_t i = 0; OB_SUCC(ret) && i < tablets.count(); ++i) {
-    const ObTabletMapKey &map_key = tablets.at(i);
-    ObMetaDiskAddr tablet_addr;
-    ObLSTabletService *ls_tablet_svr = nullptr;
-    ObLSHandle ls_handle;
-    if (OB_FAIL(replay_tablet_disk_addr_map_.get_refactored(map_key, tablet_addr))) {
-      LOG_WARN("fail to get tablet address", K(ret), K(map_key));
+    if (!tablets.at(i).tablet_id_.is_inner_tablet()) {
+      break;
+    } else if (OB_FAIL(load_tablet(tablets.at(i), buf, buf_len))) {
+      LOG_WARN("fail to load tablet", K(ret), "map_key", tablets.at(i));
     } else {
-      if (OB_NOT_NULL(buf)) {
-        if (buf_len >= tablet_addr.size()) {
-          // reuse last buf to reduce malloc
-        } else {
-          ob_free(buf);
-          buf = nullptr;
-          buf_len = 0;
-        }
+      ++inner_tablet_cnt;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (tablets.count() - inner_tablet_cnt < MIN_PARALLEL_LOAD_TABLET_CNT) {
+    for (int64_t i = inner_tablet_cnt; OB_SUCC(ret) && i < tablets.count(); ++i) {
+      if (OB_FAIL(load_tablet(tablets.at(i), buf, buf_len))) {
+        LOG_WARN("fail to load tablet", K(ret), "map_key", tablets.at(i));
       }
-      if (OB_ISNULL(buf)) {
-        if (OB_ISNULL(buf = (char*)ob_malloc(tablet_addr.size(), mem_attr))) {
-          ret = OB_ALLOCATE_MEMORY_FAILED;
-          LOG_WARN("fail to allocate tablet buffer", K(ret), K(tablet_addr));
-        } else {
-          buf_len = tablet_addr.size();
-        }
+    }
+  } else {
+    ObParallelLoadTablets load_task(*this, tablets, inner_tablet_cnt);
+    const int64_t thread_cnt = std::min(MAX_LOAD_TABLET_THREAD_CNT,
+                                        std::max(1L, common::get_cpu_count() / 2));
+    if (OB_FAIL(load_task.load(thread_cnt))) {
+      LOG_WARN("fail to load tablets in parallel", K(ret), K(thread_cnt));
+    }
+  }
+  if (OB_NOT_NULL(buf)) {
+    ob_free(buf);
+    buf = nullptr;
+  }
+  LOG_INFO("finish load tablets", K(ret), "tablet_cnt", tablets.count(), K(inner_tablet_cnt));
+  return ret;
+}
+
+int ObTenantCheckpointSlogHandler::load_tablet(
+    const ObTabletMapKey &map_key, char *&buf, int64_t &buf_len)
+{
+  int ret = OB_SUCCESS;
+  const ObMemAttr mem_attr(MTL_ID(), "TenantReplay");
+  char *r_buf = nullptr;
+  int64_t r_len = 0;
+  ObMetaDiskAddr tablet_addr;
+  ObLSTabletService *ls_tablet_svr = nullptr;
+  ObLSHandle ls_handle;
+  if (OB_FAIL(replay_tablet_disk_addr_map_.get_refactored(map_key, tablet_addr))) {
+    LOG_WARN("fail to get tablet address", K(ret), K(map_key));
+  } else {
+    if (OB_NOT_NULL(buf)) {
+      if (buf_len >= tablet_addr.size()) {
+        // reuse last buf to reduce malloc
+      } else {
+        ob_free(buf);
+        buf = nullptr;
+        buf_len = 0;
+      }
+    }
+    if (OB_ISNULL(buf)) {
+      if (OB_ISNULL(buf = (char*)ob_malloc(tablet_addr.size(), mem_attr))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to allocate tablet buffer", K(ret), K(tablet_addr));
+      } else {
+        buf_len = tablet_addr.size();
       }
     }
+  }
 
-    if (OB_FAIL(ret)) {
-    } else if (OB_FAIL(read_from_disk_addr(tablet_addr, buf, buf_len, r_buf, r_len))) {
-      LOG_WARN("fail to read tablet from addr", K(ret), K(tablet_addr));
-    } else if (OB_FAIL(get_tablet_svr(map_key.ls_id_, ls_tablet_svr, ls_handle))) {
-     LOG_WARN("fail to get ls tablet service", K(ret));
-    } else if (OB_FAIL(ls_tablet_svr->replay_create_tablet(
-        tablet_addr, r_buf, r_len, map_key.tablet_id_))) {
-     LOG_WARN("fail to create tablet for replay", K(ret), K(map_key), K(tablet_addr));
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(read_from_disk_addr(tablet_addr, buf, buf_len, r_buf, r_len))) {
+    LOG_WARN("fail to read tablet from addr", K(ret), K(tablet_addr));
+  } else if (OB_FAIL(get_tablet_svr(map_key.ls_id_, ls_tablet_svr, ls_handle))) {
+    LOG_WARN("fail to get ls tablet service", K(ret));
+  } else if (OB_FAIL(ls_tablet_svr->replay_create_tablet(
+      tablet_addr, r_buf, r_len, map_key.tablet_id_))) {
+    LOG_WARN("fail to create tablet for replay", K(ret), K(map_key), K(tablet_addr));
+  } else {
+    LOG_DEBUG("Successfully load tablet", K(map_key), K(tablet_addr));
+  }
+  return ret;
+}
+
+int ObTenantCheckpointSlogHandler::ObParallelLoadTablets::load(const int64_t thread_cnt)
+{
+  int ret = OB_SUCCESS;
+  set_run_wrapper(MTL_CTX());
+  if (OB_FAIL(set_thread_count(thread_cnt))) {
+    LOG_WARN("fail to set thread count", K(ret), K(thread_cnt));
+  } else if (OB_FAIL(start())) {
+    LOG_WARN("fail to start load tablet threads", K(ret), K(thread_cnt));
+  } else {
+    wait();
+    ret = ATOMIC_LOAD(&ret_);
+  }
+  destroy();
+  return ret;
+}
+
+void ObTenantCheckpointSlogHandler::ObParallelLoadTablets::run1()
+{
+  int ret = OB_SUCCESS;
+  char *buf = nullptr;
+  int64_t buf_len = 0;
+  lib::set_thread_name("LoadTablet");
+  for (int64_t idx = ATOMIC_FAA(&next_idx_, 1);
+       OB_SUCC(ret) && idx < tablets_.count() && OB_SUCCESS == ATOMIC_LOAD(&ret_);
+       idx = ATOMIC_FAA(&next_idx_, 1)) {
+    if (OB_FAIL(handler_.load_tablet(tablets_.at(idx), buf, buf_len))) {
+      LOG_WARN("fail to load tablet", K(ret), "map_key", tablets_.at(idx));
+      (void)ATOMIC_BCAS(&ret_, OB_SUCCESS, ret);
     }
-    LOG_INFO("Successfully load tablet", K(map_key), K(tablet_addr));
   }
   if (OB_NOT_NULL(buf)) {
     ob_free(buf);
     buf = nullptr;
   }
-  return ret;
 }
 
 int ObTenantCheckpointSlogHandler::write_checkpoint(bool is_force)
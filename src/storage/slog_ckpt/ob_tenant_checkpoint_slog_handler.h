@@ -19,6 +19,7 @@
 #include "storage/meta_mem/ob_tablet_map_key.h"
 #include "storage/ob_super_block_struct.h"
 #include "storage/slog/ob_storage_log_replayer.h"
+#include "share/ob_thread_pool.h"
 
 namespace oceanbase
 {
@@ -78,6 +79,30 @@ public:
   int read_from_disk_addr(const ObMetaDiskAddr &phy_addr, char *buf, const int64_t buf_len, char *&r_buf, int64_t &r_len);
 
 private:
+  // Load the replayed tablets in [start_idx, tablets.count()) with several threads, each
+  // thread takes the next tablet until all are loaded or any of them fails.
+  class ObParallelLoadTablets : public share::ObThreadPool
+  {
+  public:
+    ObParallelLoadTablets(ObTenantCheckpointSlogHandler &handler,
+                          const common::ObIArray<ObTabletMapKey> &tablets,
+                          const int64_t start_idx)
+      : handler_(handler), tablets_(tablets), next_idx_(start_idx), ret_(common::OB_SUCCESS)
+    {}
+    virtual ~ObParallelLoadTablets() = default;
+    int load(const int64_t thread_cnt);
+    virtual void run1() override;
+
+  private:
+    ObTenantCheckpointSlogHandler &handler_;
+    const common::ObIArray<ObTabletMapKey> &tablets_;
+    int64_t next_idx_;
+    int ret_;
+  };
+
+  static const int64_t MAX_LOAD_TABLET_THREAD_CNT = 8;
+  static const int64_t MIN_PARALLEL_LOAD_TABLET_CNT = 1000;
+
   virtual int parse(const int32_t cmd, const char *buf, const int64_t len, FILE *stream) override;
   int replay_checkpoint_and_slog(const ObTenantSuperBlock &super_block);
   int replay_checkpoint(const ObTenantSuperBlock &super_block);
@@ -86,6 +111,7 @@ private:
   int update_tablet_meta_addr_and_block_list(ObTenantStorageCheckpointWriter &ckpt_writer);
   int replay_tenant_slog(const common::ObLogCursor &start_point);
   int replay_load_tablets();
+  int load_tablet(const ObTabletMapKey &map_key, char *&buf, int64_t &buf_len);
 
   int inner_replay_update_ls_slog(const ObRedoModuleReplayParam &param);
   int inner_replay_create_ls_slog(const ObRedoModuleReplayParam &param);
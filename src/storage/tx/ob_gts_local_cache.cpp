@@ -27,6 +27,7 @@ void ObGTSLocalCache::reset()
   gts_ = 0;
   latest_srr_.reset();
   receive_gts_ts_.reset();
+  rpc_rt_ = 0;
 }
 
 //Due to network and other factors, it is impossible to guarantee that srr and gts maintain partial order,
@@ -48,6 +49,9 @@ int ObGTSLocalCache::update_gts(const MonotonicTs srr,
     (void)atomic_update(&receive_gts_ts_.mts_, receive_gts_ts.mts_);
     (void)atomic_update(&gts_, gts);
     update = atomic_update(&srr_.mts_, srr.mts_);
+    if (update) {
+      update_rpc_rt_(srr, receive_gts_ts);
+    }
   }
 
   return ret;
@@ -104,9 +108,11 @@ int ObGTSLocalCache::get_gts(int64_t &gts) const
 int ObGTSLocalCache::get_gts(const MonotonicTs stc,
                              int64_t &gts,
                              MonotonicTs &receive_gts_ts,
-                             bool &need_send_rpc) const
+                             bool &need_send_rpc,
+                             bool &is_batched) const
 {
   int ret = OB_SUCCESS;
+  is_batched = false;
 
   if (OB_UNLIKELY(!stc.is_valid())) {
     ret = OB_INVALID_ARGUMENT;
@@ -121,7 +127,16 @@ int ObGTSLocalCache::get_gts(const MonotonicTs stc,
       need_send_rpc = true;
     } else if (stc.mts_ > srr) {
       ret = OB_EAGAIN;
-      need_send_rpc = (stc.mts_ > ATOMIC_LOAD(&latest_srr_.mts_));
+      // the requests arriving while a gts rpc is on the way are batched into
+      // the follow-up rpc sent on its response, so that at most one rpc per
+      // round trip is sent for the tenant
+      if (stc.mts_ <= ATOMIC_LOAD(&latest_srr_.mts_)) {
+        // the rpc already sent covers the request
+        need_send_rpc = false;
+      } else {
+        is_batched = is_rpc_inflight(MonotonicTs::current_time());
+        need_send_rpc = !is_batched;
+      }
     } else {
       //Here should not add 1
       gts = tmp_gts;
@@ -159,5 +174,27 @@ int ObGTSLocalCache::update_latest_srr(const MonotonicTs latest_srr)
   return ret;
 }
 
+bool ObGTSLocalCache::is_rpc_inflight(const MonotonicTs now) const
+{
+  const int64_t srr = ATOMIC_LOAD(&srr_.mts_);
+  const int64_t latest_srr = ATOMIC_LOAD(&latest_srr_.mts_);
+  // the window follows the observed round trip time, and the bound makes sure
+  // that a lost request or response can not stall the waiters
+  const int64_t batch_window = std::min(std::max(2 * ATOMIC_LOAD(&rpc_rt_), MIN_BATCH_WINDOW_US),
+                                        MAX_BATCH_WINDOW_US);
+  return latest_srr > srr && now.mts_ - latest_srr < batch_window;
+}
+
+void ObGTSLocalCache::update_rpc_rt_(const MonotonicTs srr, const MonotonicTs receive_gts_ts)
+{
+  const int64_t rt = receive_gts_ts.mts_ - srr.mts_;
+  if (rt > 0) {
+    const int64_t old_rt = ATOMIC_LOAD(&rpc_rt_);
+    // the concurrent updates may overwrite each other, which is harmless for
+    // a smoothed estimation
+    ATOMIC_STORE(&rpc_rt_, 0 == old_rt ? rt : (old_rt * 7 + rt) / 8);
+  }
+}
+
 } // transaction
 } // oceanbase
@@ -42,12 +42,27 @@ public:
   int get_gts(int64_t &gts) const;
   MonotonicTs get_latest_srr() const { return MonotonicTs(ATOMIC_LOAD(&latest_srr_.mts_)); }
   MonotonicTs get_srr() const { return MonotonicTs(ATOMIC_LOAD(&srr_.mts_)); }
-  int get_gts(const MonotonicTs stc, int64_t &gts, MonotonicTs &receive_gts_ts, bool &need_send_rpc) const;
+  // is_batched is set if the request joins the inflight rpc instead of
+  // sending its own one
+  int get_gts(const MonotonicTs stc,
+              int64_t &gts,
+              MonotonicTs &receive_gts_ts,
+              bool &need_send_rpc,
+              bool &is_batched) const;
   int get_srr_and_gts_safe(MonotonicTs &srr, int64_t &gts, MonotonicTs &receive_gts_ts) const;
   int update_latest_srr(const MonotonicTs latest_srr);
+  // whether the latest gts request has not been answered yet and is still
+  // within the batching window, in which case new waiters join its response
+  // (or the follow-up request sent when it arrives) instead of sending one
+  bool is_rpc_inflight(const MonotonicTs now) const;
+  int64_t get_rpc_rt() const { return ATOMIC_LOAD(&rpc_rt_); }
 
-  TO_STRING_KV(K_(srr), K_(gts), K_(latest_srr));
+  TO_STRING_KV(K_(srr), K_(gts), K_(latest_srr), K_(rpc_rt));
 private:
+  void update_rpc_rt_(const MonotonicTs srr, const MonotonicTs receive_gts_ts);
+private:
+  static const int64_t MIN_BATCH_WINDOW_US = 200;
+  static const int64_t MAX_BATCH_WINDOW_US = 10 * 1000;
   // send rpc request timestamp
   MonotonicTs srr_;
   // The latest local gts value is always less than or equal to the gts leader
@@ -55,6 +70,9 @@ private:
   MonotonicTs latest_srr_;
   // receive gts
   MonotonicTs receive_gts_ts_;
+  // moving average of the gts rpc round trip time, which is used as the
+  // adaptive batching window
+  int64_t rpc_rt_;
 };
 
 } // transaction
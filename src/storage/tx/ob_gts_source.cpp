@@ -41,6 +41,9 @@ void ObGtsStatistics::reset()
   try_get_gts_with_stc_cnt_ = 0;
   wait_gts_elapse_cnt_ = 0;
   try_wait_gts_elapse_cnt_ = 0;
+  gts_rpc_batched_cnt_ = 0;
+  gts_follow_up_rpc_cnt_ = 0;
+  gts_prefetch_cnt_ = 0;
 }
 
 int ObGtsStatistics::init(const uint64_t tenant_id)
@@ -67,7 +70,10 @@ void ObGtsStatistics::statistics()
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
                       "try_get_gts_with_stc_cnt", ATOMIC_LOAD(&try_get_gts_with_stc_cnt_),
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
-                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
+                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_),
+                      "gts_rpc_batched_cnt", ATOMIC_LOAD(&gts_rpc_batched_cnt_),
+                      "gts_follow_up_rpc_cnt", ATOMIC_LOAD(&gts_follow_up_rpc_cnt_),
+                      "gts_prefetch_cnt", ATOMIC_LOAD(&gts_prefetch_cnt_));
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
@@ -75,6 +81,9 @@ void ObGtsStatistics::statistics()
       ATOMIC_STORE(&try_get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&wait_gts_elapse_cnt_, 0);
       ATOMIC_STORE(&try_wait_gts_elapse_cnt_, 0);
+      ATOMIC_STORE(&gts_rpc_batched_cnt_, 0);
+      ATOMIC_STORE(&gts_follow_up_rpc_cnt_, 0);
+      ATOMIC_STORE(&gts_prefetch_cnt_, 0);
     }
   }
 
@@ -200,6 +209,7 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
   int tmp_ret = OB_SUCCESS;
   int64_t tmp_gts = 0;
   bool need_send_rpc = false;
+  bool is_batched = false;
   ObAddr leader;
 
   if (OB_UNLIKELY(!is_inited_)) {
@@ -211,7 +221,8 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
   } else if (OB_SUCCESS == (ret = gts_local_cache_.get_gts(stc,
                                                            tmp_gts,
                                                            receive_gts_ts,
-                                                           need_send_rpc))) {
+                                                           need_send_rpc,
+                                                           is_batched))) {
     //Able to find a suitable gts value
     gts = tmp_gts;
   } else if (OB_UNLIKELY(OB_EAGAIN != ret)) {
@@ -250,6 +261,8 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
         if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
           TRANS_LOG(WARN, "query gts fail", K(tmp_ret), K(leader));
         }
+      } else if (is_batched) {
+        gts_statistics_.inc_gts_rpc_batched_cnt();
       }
       TRANS_LOG(DEBUG, "after query gts", KR(tmp_ret), K(leader), K(need_send_rpc));
     }
@@ -669,11 +682,55 @@ int ObGtsSource::handle_gts_result(const uint64_t tenant_id, const int64_t queue
     ObGTSTaskQueue *queue = &(queue_[queue_index]);
     if (OB_FAIL(queue->foreach_task(srr, gts, receive_gts_ts))) {
       TRANS_LOG(WARN, "iterate task failed", KR(ret), K(queue_index));
+    } else {
+      (void)send_follow_up_rpc_(queue_index);
+    }
+  }
+  return ret;
+}
+
+// The tasks left in the queue arrived after the answered rpc was sent, one rpc
+// is sent for all of them rather than one per task.
+int ObGtsSource::send_follow_up_rpc_(const int64_t queue_index)
+{
+  int ret = OB_SUCCESS;
+  if (queue_[queue_index].get_task_count() > 0
+      && !gts_local_cache_.is_rpc_inflight(MonotonicTs::current_time())) {
+    const bool need_refresh_gts_location = false;
+    if (OB_FAIL(refresh_gts_(need_refresh_gts_location))) {
+      if (EXECUTE_COUNT_PER_SEC(16)) {
+        TRANS_LOG(WARN, "send follow up gts rpc failed", KR(ret), K(queue_index));
+      }
+    } else {
+      gts_statistics_.inc_gts_follow_up_rpc_cnt();
     }
   }
   return ret;
 }
 
+int ObGtsSource::prefetch_gts(const int64_t prefetch_interval)
+{
+  int ret = OB_SUCCESS;
+  const MonotonicTs now = MonotonicTs::current_time();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    TRANS_LOG(WARN, "not inited", K(ret));
+  } else if (OB_UNLIKELY(0 >= prefetch_interval)) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", KR(ret), K(prefetch_interval));
+  } else if (now.mts_ - gts_local_cache_.get_srr().mts_ < prefetch_interval
+             || gts_local_cache_.is_rpc_inflight(now)) {
+    // the local cache is fresh enough
+  } else if (OB_FAIL(refresh_gts_(false))) {
+    if (EXECUTE_COUNT_PER_SEC(16)) {
+      TRANS_LOG(WARN, "prefetch gts failed", KR(ret), K(prefetch_interval));
+    }
+  } else {
+    gts_statistics_.inc_gts_prefetch_cnt();
+  }
+  return ret;
+}
+
 int ObGtsSource::handle_gts_err_response(const ObGtsErrResponse &err_msg)
 {
   int ret = OB_SUCCESS;
@@ -51,6 +51,9 @@ public:
   void inc_try_get_gts_with_stc_cnt() { ATOMIC_INC(&try_get_gts_with_stc_cnt_); }
   void inc_wait_gts_elapse_cnt() { ATOMIC_INC(&wait_gts_elapse_cnt_); }
   void inc_try_wait_gts_elapse_cnt() { ATOMIC_INC(&try_wait_gts_elapse_cnt_); }
+  void inc_gts_rpc_batched_cnt() { ATOMIC_INC(&gts_rpc_batched_cnt_); }
+  void inc_gts_follow_up_rpc_cnt() { ATOMIC_INC(&gts_follow_up_rpc_cnt_); }
+  void inc_gts_prefetch_cnt() { ATOMIC_INC(&gts_prefetch_cnt_); }
   void statistics();
 private:
   uint64_t tenant_id_;
@@ -64,6 +67,11 @@ private:
 
   int64_t wait_gts_elapse_cnt_;
   int64_t try_wait_gts_elapse_cnt_;
+
+  // requests served by an inflight rpc instead of sending their own
+  int64_t gts_rpc_batched_cnt_;
+  int64_t gts_follow_up_rpc_cnt_;
+  int64_t gts_prefetch_cnt_;
 };
 
 class ObGtsSource
@@ -90,10 +98,14 @@ public:
   int wait_gts_elapse(const int64_t ts, ObTsCbTask *task, bool &need_wait);
   int wait_gts_elapse(const int64_t ts);
   int refresh_gts(const bool need_refresh);
+  // keep the local cache no older than prefetch_interval, so that requests
+  // whose stc is moved ahead by _ob_get_gts_ahead_interval are served locally
+  int prefetch_gts(const int64_t prefetch_interval);
   bool is_external_consistent() { return true; }
   int refresh_gts_location() { return refresh_gts_location_(); }
   TO_STRING_KV(K_(tenant_id), K_(gts_local_cache), K_(server), K_(gts_cache_leader));
 private:
+  int send_follow_up_rpc_(const int64_t queue_index);
   int get_gts_leader_(common::ObAddr &leader);
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
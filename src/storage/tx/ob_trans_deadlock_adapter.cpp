@@ -766,6 +766,32 @@ int ObTransDeadlockDetectorAdapter::change_detector_waiting_obj_from_row_to_tran
   #undef PRINT_WRAPPER
 }
 
+// Call from LockWaitMgr, a waiter transferred from row to trans is parked back on the row
+// in handoff mode, so the dependency must follow the row holder again
+//
+// @param [in] self_trans_id who am i.
+// @param [in] func resolve the row holder when detector collecting dependency.
+// @return the error code.
+int ObTransDeadlockDetectorAdapter::change_detector_waiting_obj_from_trans_to_row(const ObTransID &self_trans_id,
+                                                                                  const BlockCallBack &func)
+{
+  #define PRINT_WRAPPER KR(ret), K(self_trans_id)
+  CHECK_DEADLOCK_ENABLED();
+  int ret = OB_SUCCESS;
+  if (nullptr == (MTL(ObDeadLockDetectorMgr*))) {
+    ret = OB_ERR_UNEXPECTED;
+    DETECT_LOG(WARN, "fail to get ObDeadLockDetectorMgr", PRINT_WRAPPER);
+  } else if (OB_FAIL(MTL(ObDeadLockDetectorMgr*)->activate_all(self_trans_id))) {
+    DETECT_LOG(WARN, "fail to activate all", PRINT_WRAPPER);
+  } else if (OB_FAIL(MTL(ObDeadLockDetectorMgr*)->block(self_trans_id, func))) {
+    DETECT_LOG(WARN, "fail to block on call back function", PRINT_WRAPPER);
+  } else {
+    DETECT_LOG(INFO, "change denpendency relationship from trans to row", PRINT_WRAPPER);
+  }
+  return ret;
+  #undef PRINT_WRAPPER
+}
+
 // Register autonomous trans dependency relationship, no need session id here, cause this trans should not be killed
 // 
 // @param [in] last_trans_id who is the trans before start autonomous trans.
@@ -130,6 +130,10 @@ class ObTransDeadlockDetectorAdapter
   static int change_detector_waiting_obj_from_row_to_trans(const ObTransID &self_trans_id,
                                                            const ObTransID &conflict_trans_id,
                                                            const ObAddr &scheduler_addr);
+  // if a waiter transferred to the trans is handed back to the row queue by lock wait mgr
+  // change the dependency relationship from trans back to row
+  static int change_detector_waiting_obj_from_trans_to_row(const ObTransID &self_trans_id,
+                                                           const BlockCallBack &func);
   // for all path
   static void unregister_from_deadlock_detector(const ObTransID &self_trans_id, const UnregisterPath path);
   /**********************************/
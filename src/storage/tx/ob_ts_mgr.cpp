@@ -15,6 +15,7 @@
 #include "share/ob_define.h"
 #include "share/ob_cluster_version.h"
 #include "share/scn.h"
+#include "share/config/ob_server_config.h"
 #include "ob_trans_event.h"
 #include "share/schema/ob_multi_version_schema_service.h"
 #include "share/schema/ob_schema_getter_guard.h"
@@ -265,9 +266,27 @@ void ObTsMgr::run1()
   CheckTenantFunctor check_tenant_functor(check_ids);
   // cluster版本小于2.0不会更新gts
   lib::set_thread_name("TsMgr");
+  int64_t last_refresh_ts = 0;
   while (!has_set_stop()) {
-    // sleep 100 * 1000 us
-    ob_usleep(REFRESH_GTS_INTERVEL_US);
+    // When the stc of requests is moved ahead by _ob_get_gts_ahead_interval,
+    // the gts cache is prefetched every half of the interval so that these
+    // requests can be served without waiting for a gts rpc.
+    const int64_t gts_ahead_interval = GCONF._ob_get_gts_ahead_interval;
+    const int64_t prefetch_interval = gts_ahead_interval / 2;
+    if (prefetch_interval > 0) {
+      ob_usleep(std::min(std::max(prefetch_interval, MIN_GTS_PREFETCH_INTERVAL_US),
+                         static_cast<int64_t>(REFRESH_GTS_INTERVEL_US)));
+      ObGtsPrefetchFunctor gts_prefetch_functor(prefetch_interval);
+      ts_source_info_map_.for_each(gts_prefetch_functor);
+    } else {
+      // sleep 100 * 1000 us
+      ob_usleep(REFRESH_GTS_INTERVEL_US);
+    }
+    const int64_t now = ObClockGenerator::getClock();
+    if (now - last_refresh_ts < REFRESH_GTS_INTERVEL_US) {
+      continue;
+    }
+    last_refresh_ts = now;
     ts_source_info_map_.for_each(gts_refresh_funtor);
     ts_source_info_map_.for_each(get_obsolete_tenant_functor);
     ts_source_info_map_.for_each(check_tenant_functor);
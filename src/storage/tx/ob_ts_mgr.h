@@ -177,6 +177,37 @@ public:
   }
 };
 
+class ObGtsPrefetchFunctor
+{
+public:
+  explicit ObGtsPrefetchFunctor(const int64_t prefetch_interval)
+      : prefetch_interval_(prefetch_interval) {}
+  ~ObGtsPrefetchFunctor() {}
+  bool operator()(const ObTsTenantInfo &gts_tenant_info, ObTsSourceInfo *ts_source_info)
+  {
+    int ret = common::OB_SUCCESS;
+    ObGtsSource *gts_source = NULL;
+    const int64_t now = common::ObClockGenerator::getClock();
+    if (OB_ISNULL(ts_source_info)) {
+      ret = common::OB_ERR_UNEXPECTED;
+      TRANS_LOG(ERROR, "ts source info is null", KR(ret));
+    } else if (now - ts_source_info->get_last_access_ts() > PREFETCH_ACTIVE_TIME) {
+      // only prefetch for the tenants which are acquiring gts
+    } else if (NULL == (gts_source = (ts_source_info->get_gts_source()))) {
+      ret = common::OB_ERR_UNEXPECTED;
+      TRANS_LOG(ERROR, "gts cache queue is null", KR(ret), K(gts_tenant_info));
+    } else if (OB_FAIL(gts_source->prefetch_gts(prefetch_interval_))) {
+      if (EXECUTE_COUNT_PER_SEC(1)) {
+        TRANS_LOG(WARN, "prefetch gts failed", KR(ret), K(gts_tenant_info));
+      }
+    }
+    return true;
+  }
+private:
+  static const int64_t PREFETCH_ACTIVE_TIME = 1000 * 1000;
+  const int64_t prefetch_interval_;
+};
+
 class GetObsoleteTenantFunctor
 {
 public:
@@ -309,6 +340,7 @@ public:
 private:
   static const int64_t TS_SOURCE_INFO_OBSOLETE_TIME = 120 * 1000 * 1000;
   static const int64_t TS_SOURCE_INFO_CACHE_NUM = 4096;
+  static const int64_t MIN_GTS_PREFETCH_INTERVAL_US = 1000;
 private:
   int get_ts_source_info_opt_(const uint64_t tenant_id, ObTsSourceInfoGuard &guard,
       const bool need_create_tenant, const bool need_update_access_ts);
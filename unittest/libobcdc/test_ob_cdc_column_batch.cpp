@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "ob_cdc_column_batch.h"    // ObCDCColumnBatch
+
+using namespace oceanbase::common;
+namespace oceanbase
+{
+namespace libobcdc
+{
+static const int64_t ROW_COUNT = 4;
+static const int64_t COLUMN_NUM = 3;
+
+class TestCDCColumnBatch : public ::testing::Test
+{
+public:
+  TestCDCColumnBatch() : allocator_("TestColBatch") {}
+  ~TestCDCColumnBatch() {}
+
+  // column 0: bigint, column 1: varchar, column 2: double with NULL in odd rows
+  void build_rows()
+  {
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      ASSERT_EQ(OB_SUCCESS, rows_[i].init(allocator_, 1001, 500001, 1, COLUMN_NUM, false));
+      objs_[i][0].set_int(i * 10);
+      objs_[i][1].set_varchar("abc", static_cast<int32_t>(i));
+      strs_[i][1].assign_ptr(objs_[i][1].get_string_ptr(), objs_[i][1].get_string_len());
+      if (i % 2 == 0) {
+        objs_[i][2].set_double(static_cast<double>(i) + 0.5);
+      } else {
+        objs_[i][2].set_null();
+      }
+      for (int64_t col = 0; col < COLUMN_NUM; col++) {
+        rows_[i].new_objs_[col] = &objs_[i][col];
+        rows_[i].new_strs_[col] = &strs_[i][col];
+      }
+    }
+  }
+
+public:
+  ObArenaAllocator allocator_;
+  ObCDCRowColumns rows_[ROW_COUNT];
+  ObObj objs_[ROW_COUNT][COLUMN_NUM];
+  ObString strs_[ROW_COUNT][COLUMN_NUM];
+  int64_t fake_records_[ROW_COUNT];
+};
+
+TEST_F(TestCDCColumnBatch, column_type)
+{
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, ObCDCColumnBatch::get_column_type(ObTinyIntType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, ObCDCColumnBatch::get_column_type(ObIntType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_UINT64, ObCDCColumnBatch::get_column_type(ObUInt64Type));
+  EXPECT_EQ(CDC_COLUMN_TYPE_FLOAT, ObCDCColumnBatch::get_column_type(ObFloatType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_DOUBLE, ObCDCColumnBatch::get_column_type(ObDoubleType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_DATE, ObCDCColumnBatch::get_column_type(ObDateType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_DATETIME, ObCDCColumnBatch::get_column_type(ObDateTimeType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_DATETIME, ObCDCColumnBatch::get_column_type(ObTimestampType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_TIME, ObCDCColumnBatch::get_column_type(ObTimeType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_STRING, ObCDCColumnBatch::get_column_type(ObVarcharType));
+  EXPECT_EQ(CDC_COLUMN_TYPE_STRING, ObCDCColumnBatch::get_column_type(ObNumberType));
+  EXPECT_FALSE(ObCDCColumnBatch::is_native_obj_type(ObLongTextType));
+  EXPECT_TRUE(ObCDCColumnBatch::is_native_obj_type(ObUTinyIntType));
+}
+
+TEST_F(TestCDCColumnBatch, append)
+{
+  ObCDCColumnBatch batch;
+  build_rows();
+  ASSERT_EQ(OB_SUCCESS, batch.init(ROW_COUNT));
+
+  ObCDCRowColumns other_table;
+  ASSERT_EQ(OB_SUCCESS, other_table.init(allocator_, 1001, 500002, 1, COLUMN_NUM, false));
+
+  // non-DML record is output alone
+  EXPECT_TRUE(batch.can_append(NULL));
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_TRUE(batch.can_append(&rows_[i]));
+    ASSERT_EQ(OB_SUCCESS, batch.append(reinterpret_cast<ICDCRecord *>(&fake_records_[i]), &rows_[i]));
+    EXPECT_FALSE(batch.can_append(NULL));
+    EXPECT_FALSE(batch.can_append(&other_table));
+  }
+  EXPECT_TRUE(batch.is_full());
+  EXPECT_FALSE(batch.can_append(&rows_[0]));
+  EXPECT_EQ(ROW_COUNT, batch.get_row_count());
+  EXPECT_EQ(COLUMN_NUM, batch.get_column_count());
+  EXPECT_EQ(reinterpret_cast<ICDCRecord *>(&fake_records_[1]), batch.get_record(1));
+  EXPECT_EQ(NULL, batch.get_record(ROW_COUNT));
+}
+
+TEST_F(TestCDCColumnBatch, get_column)
+{
+  ObCDCColumnBatch batch;
+  ObCDCColumnVector vector;
+  build_rows();
+  ASSERT_EQ(OB_SUCCESS, batch.init(ROW_COUNT));
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    ASSERT_EQ(OB_SUCCESS, batch.append(reinterpret_cast<ICDCRecord *>(&fake_records_[i]), &rows_[i]));
+  }
+
+  EXPECT_EQ(OB_INVALID_ARGUMENT, batch.get_column(COLUMN_NUM, true, vector));
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(0, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, vector.type_);
+  EXPECT_EQ(ROW_COUNT, vector.row_count_);
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_FALSE(vector.is_null(i));
+    EXPECT_EQ(i * 10, static_cast<const int64_t *>(vector.values_)[i]);
+  }
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(1, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_STRING, vector.type_);
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_FALSE(vector.is_null(i));
+    EXPECT_EQ(i, vector.str_lens_[i]);
+    EXPECT_EQ(0, strncmp("abc", vector.str_ptrs_[i], i));
+  }
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(2, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_DOUBLE, vector.type_);
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_EQ(i % 2 != 0, vector.is_null(i));
+    if (i % 2 == 0) {
+      EXPECT_EQ(static_cast<double>(i) + 0.5, static_cast<const double *>(vector.values_)[i]);
+    }
+  }
+
+  // no old value
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(0, false, vector));
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_TRUE(vector.is_null(i));
+  }
+}
+
+TEST_F(TestCDCColumnBatch, inconsistent_type)
+{
+  ObCDCColumnBatch batch;
+  ObCDCColumnVector vector;
+  build_rows();
+  // row 1 of column 0 is uint64, the column falls back to string
+  objs_[1][0].set_uint64(7);
+  ASSERT_EQ(OB_SUCCESS, batch.init(ROW_COUNT));
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    ASSERT_EQ(OB_SUCCESS, batch.append(reinterpret_cast<ICDCRecord *>(&fake_records_[i]), &rows_[i]));
+  }
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(0, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_STRING, vector.type_);
+  EXPECT_EQ(0, strncmp("7", vector.str_ptrs_[1], vector.str_lens_[1]));
+  EXPECT_EQ(0, strncmp("20", vector.str_ptrs_[2], vector.str_lens_[2]));
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_ob_cdc_column_batch.log", true);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
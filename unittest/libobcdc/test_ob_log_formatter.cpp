@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "ob_log_formatter.h"       // ObLogFormatter
+#undef private
+#include "ob_cdc_column_batch.h"    // ObCDCColumnBatch
+
+using namespace oceanbase::common;
+using namespace oceanbase::blocksstable;
+namespace oceanbase
+{
+namespace libobcdc
+{
+static const int64_t ROW_COUNT = 2;
+static const int64_t COLUMN_NUM = 3;
+
+// Typed column values filled by formatter for binary column batch,
+// column 0: bigint primary key, column 1: bigint default 7, column 2: varchar default 'x'
+class TestLogFormatterRowColumns : public ::testing::Test
+{
+public:
+  TestLogFormatterRowColumns() : allocator_("TestFormatter") {}
+  ~TestLogFormatterRowColumns() {}
+
+  virtual void SetUp()
+  {
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      row_values_[i] = new ObLogFormatter::RowValue();
+      row_values_[i]->reset();
+      ASSERT_EQ(OB_SUCCESS, row_values_[i]->init(COLUMN_NUM, false));
+    }
+    default_obj_.set_int(7);
+    default_int_str_.assign_ptr("7", 1);
+    default_varchar_str_.assign_ptr("x", 1);
+  }
+  virtual void TearDown()
+  {
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      delete row_values_[i];
+      row_values_[i] = NULL;
+    }
+  }
+
+  void set_value(ObLogFormatter::RowValue &rv, const int64_t col, const bool is_new, ObObj &obj, ObString &str)
+  {
+    if (is_new) {
+      rv.new_objs_[col] = &obj;
+      rv.new_columns_[col] = &str;
+      rv.is_changed_[col] = true;
+    } else {
+      rv.old_objs_[col] = &obj;
+      rv.old_columns_[col] = &str;
+    }
+  }
+  // as fill_orig_default_value_ does, only for columns without any value
+  void set_default_values(ObLogFormatter::RowValue &rv)
+  {
+    if (NULL == rv.new_columns_[1] && NULL == rv.old_columns_[1]) {
+      rv.orig_default_objs_[1] = &default_obj_;
+      rv.orig_default_value_[1] = &default_int_str_;
+    }
+    if (NULL == rv.new_columns_[2] && NULL == rv.old_columns_[2]) {
+      rv.orig_default_value_[2] = &default_varchar_str_;
+    }
+  }
+  void build_batch(const ObDmlFlag dml_flag, const bool contain_old_column, ObCDCColumnBatch &batch)
+  {
+    ASSERT_EQ(OB_SUCCESS, batch.init(ROW_COUNT));
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      ObLogFormatter::RowValue &rv = *row_values_[i];
+      rv.dml_flag_ = dml_flag;
+      rv.contain_old_column_ = contain_old_column;
+      set_default_values(rv);
+      ASSERT_EQ(OB_SUCCESS, rows_[i].init(allocator_, 1001, 500001, 1, COLUMN_NUM, contain_old_column));
+      ObLogFormatter::fill_row_columns_(rv, rows_[i]);
+      ASSERT_EQ(OB_SUCCESS, batch.append(reinterpret_cast<ICDCRecord *>(&fake_records_[i]), &rows_[i]));
+    }
+  }
+
+public:
+  ObArenaAllocator allocator_;
+  ObLogFormatter::RowValue *row_values_[ROW_COUNT];
+  ObCDCRowColumns rows_[ROW_COUNT];
+  ObObj objs_[ROW_COUNT][COLUMN_NUM];
+  ObString strs_[ROW_COUNT][COLUMN_NUM];
+  ObObj old_objs_[ROW_COUNT][COLUMN_NUM];
+  ObString old_strs_[ROW_COUNT][COLUMN_NUM];
+  ObObj default_obj_;
+  ObString default_int_str_;
+  ObString default_varchar_str_;
+  int64_t fake_records_[ROW_COUNT];
+};
+
+TEST_F(TestLogFormatterRowColumns, insert_with_default_value)
+{
+  ObCDCColumnBatch batch;
+  ObCDCColumnVector vector;
+  // row 0 only sets the primary key, row 1 sets column 1 as well
+  objs_[0][0].set_int(1);
+  set_value(*row_values_[0], 0, true, objs_[0][0], strs_[0][0]);
+  objs_[1][0].set_int(2);
+  set_value(*row_values_[1], 0, true, objs_[1][0], strs_[1][0]);
+  objs_[1][1].set_int(20);
+  set_value(*row_values_[1], 1, true, objs_[1][1], strs_[1][1]);
+  build_batch(ObDmlFlag::DF_INSERT, false, batch);
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(1, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, vector.type_);
+  EXPECT_FALSE(vector.is_null(0));
+  EXPECT_FALSE(vector.is_unchanged(0));
+  EXPECT_EQ(7, static_cast<const int64_t *>(vector.values_)[0]);
+  EXPECT_EQ(20, static_cast<const int64_t *>(vector.values_)[1]);
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(2, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_STRING, vector.type_);
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_FALSE(vector.is_null(i));
+    EXPECT_FALSE(vector.is_unchanged(i));
+    EXPECT_EQ(1, vector.str_lens_[i]);
+    EXPECT_EQ(0, strncmp("x", vector.str_ptrs_[i], 1));
+  }
+
+  // no old value
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(1, false, vector));
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_TRUE(vector.is_null(i));
+    EXPECT_FALSE(vector.is_unchanged(i));
+  }
+}
+
+TEST_F(TestLogFormatterRowColumns, partial_update)
+{
+  ObCDCColumnBatch batch;
+  ObCDCColumnVector vector;
+  // row 0 updates column 1, row 1 updates column 2, rowkey is always set
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    objs_[i][0].set_int(i);
+    set_value(*row_values_[i], 0, true, objs_[i][0], strs_[i][0]);
+    row_values_[i]->is_rowkey_[0] = true;
+  }
+  objs_[0][1].set_int(8);
+  set_value(*row_values_[0], 1, true, objs_[0][1], strs_[0][1]);
+  objs_[1][2].set_varchar("y", 1);
+  strs_[1][2].assign_ptr("y", 1);
+  set_value(*row_values_[1], 2, true, objs_[1][2], strs_[1][2]);
+  build_batch(ObDmlFlag::DF_UPDATE, false, batch);
+
+  // the unchanged column is not filled with the default value
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(1, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, vector.type_);
+  EXPECT_FALSE(vector.is_unchanged(0));
+  EXPECT_FALSE(vector.is_null(0));
+  EXPECT_EQ(8, static_cast<const int64_t *>(vector.values_)[0]);
+  EXPECT_TRUE(vector.is_unchanged(1));
+  EXPECT_TRUE(vector.is_null(1));
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(2, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_STRING, vector.type_);
+  EXPECT_TRUE(vector.is_unchanged(0));
+  EXPECT_FALSE(vector.is_unchanged(1));
+  EXPECT_EQ(0, strncmp("y", vector.str_ptrs_[1], vector.str_lens_[1]));
+
+  // old values only tell whether the column is changed
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(0, false, vector));
+  EXPECT_FALSE(vector.is_unchanged(0));
+  EXPECT_FALSE(vector.is_unchanged(1));
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(1, false, vector));
+  EXPECT_FALSE(vector.is_unchanged(0));
+  EXPECT_TRUE(vector.is_unchanged(1));
+}
+
+TEST_F(TestLogFormatterRowColumns, full_column_update)
+{
+  ObCDCColumnBatch batch;
+  ObCDCColumnVector vector;
+  // both rows update column 1, row 0 has old value of column 2, row 1 has not (added column)
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    objs_[i][0].set_int(i);
+    set_value(*row_values_[i], 0, true, objs_[i][0], strs_[i][0]);
+    row_values_[i]->is_rowkey_[0] = true;
+    old_objs_[i][0].set_int(i);
+    set_value(*row_values_[i], 0, false, old_objs_[i][0], old_strs_[i][0]);
+    objs_[i][1].set_int(100 + i);
+    set_value(*row_values_[i], 1, true, objs_[i][1], strs_[i][1]);
+    old_objs_[i][1].set_int(i);
+    set_value(*row_values_[i], 1, false, old_objs_[i][1], old_strs_[i][1]);
+  }
+  old_objs_[0][2].set_varchar("z", 1);
+  old_strs_[0][2].assign_ptr("z", 1);
+  set_value(*row_values_[0], 2, false, old_objs_[0][2], old_strs_[0][2]);
+  build_batch(ObDmlFlag::DF_UPDATE, true, batch);
+
+  // the unchanged column takes the old value, or the default value if there is none
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(2, true, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_STRING, vector.type_);
+  for (int64_t i = 0; i < ROW_COUNT; i++) {
+    EXPECT_FALSE(vector.is_unchanged(i));
+    EXPECT_FALSE(vector.is_null(i));
+  }
+  EXPECT_EQ(0, strncmp("z", vector.str_ptrs_[0], vector.str_lens_[0]));
+  EXPECT_EQ(0, strncmp("x", vector.str_ptrs_[1], vector.str_lens_[1]));
+
+  ASSERT_EQ(OB_SUCCESS, batch.get_column(1, false, vector));
+  EXPECT_EQ(CDC_COLUMN_TYPE_INT64, vector.type_);
+  EXPECT_EQ(0, static_cast<const int64_t *>(vector.values_)[0]);
+  EXPECT_EQ(1, static_cast<const int64_t *>(vector.values_)[1]);
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_ob_log_formatter.log", true);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#define private public
+#include "ob_log_storager.h"        // ObLogStorager
+#undef private
+#include "ob_log_factory.h"         // ObLogStoreTaskFactory
+
+using namespace oceanbase::common;
+namespace oceanbase
+{
+namespace libobcdc
+{
+static const int64_t TASK_COUNT = 8;
+static const uint64_t TENANT_ID = 1002;
+static const int64_t LS_ID = 1001;
+
+// Store service keeping key/value in memory, put and batch_write write into the same map
+class MockStoreService : public IObStoreService
+{
+public:
+  MockStoreService() : put_count_(0), batch_write_count_(0), batch_write_ret_(OB_SUCCESS), kv_() {}
+  virtual ~MockStoreService() {}
+  virtual int init(const std::string &path) { UNUSED(path); return OB_SUCCESS; }
+  virtual int close() { return OB_SUCCESS; }
+
+public:
+  virtual int put(const std::string &key, const ObSlice &value)
+  {
+    return put(NULL, key, value);
+  }
+  virtual int put(void *cf_handle, const std::string &key, const ObSlice &value)
+  {
+    UNUSED(cf_handle);
+    put_count_++;
+    kv_[key] = std::string(value.buf_, value.buf_len_);
+    return OB_SUCCESS;
+  }
+  virtual int batch_write(void *cf_handle, const std::vector<std::string> &keys, const std::vector<ObSlice> &values)
+  {
+    int ret = batch_write_ret_;
+    UNUSED(cf_handle);
+    if (OB_SUCC(ret)) {
+      batch_write_count_++;
+      for (int64_t idx = 0; idx < static_cast<int64_t>(keys.size()); idx++) {
+        kv_[keys[idx]] = std::string(values[idx].buf_, values[idx].buf_len_);
+      }
+    }
+    return ret;
+  }
+  virtual int get(const std::string &key, std::string &value) { return get(NULL, key, value); }
+  virtual int get(void *cf_handle, const std::string &key, std::string &value)
+  {
+    int ret = OB_SUCCESS;
+    UNUSED(cf_handle);
+    std::map<std::string, std::string>::const_iterator iter = kv_.find(key);
+    if (kv_.end() == iter) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      value = iter->second;
+    }
+    return ret;
+  }
+  virtual int del(const std::string &key) { return del(NULL, key); }
+  virtual int del(void *cf_handle, const std::string &key)
+  {
+    UNUSED(cf_handle);
+    kv_.erase(key);
+    return OB_SUCCESS;
+  }
+  virtual int del_range(void *cf_handle, const std::string &begin_key, const std::string &end_key)
+  {
+    UNUSED(cf_handle);
+    UNUSED(begin_key);
+    UNUSED(end_key);
+    return OB_NOT_SUPPORTED;
+  }
+  virtual int create_column_family(const std::string& column_family_name, void *&cf_handle)
+  {
+    UNUSED(column_family_name);
+    cf_handle = NULL;
+    return OB_SUCCESS;
+  }
+  virtual int drop_column_family(void *cf_handle) { UNUSED(cf_handle); return OB_SUCCESS; }
+  virtual int destory_column_family(void *cf_handle) { UNUSED(cf_handle); return OB_SUCCESS; }
+  virtual void get_mem_usage(const std::vector<uint64_t> ids, const std::vector<void *> cf_handles)
+  {
+    UNUSED(ids);
+    UNUSED(cf_handles);
+  }
+
+public:
+  int64_t put_count_;
+  int64_t batch_write_count_;
+  int batch_write_ret_;
+  std::map<std::string, std::string> kv_;
+};
+
+class MockLogCallback : public ObILogCallback
+{
+public:
+  MockLogCallback() : callback_count_(0) {}
+  virtual int handle_log_callback() { callback_count_++; return OB_SUCCESS; }
+
+public:
+  int64_t callback_count_;
+};
+
+class TestLogStorager : public ::testing::Test
+{
+public:
+  TestLogStorager() : storager_(), store_service_(), log_callback_() {}
+  ~TestLogStorager() {}
+
+  virtual void SetUp()
+  {
+    // Only the write batch path is tested, storager threads are not started
+    storager_.inited_ = true;
+    storager_.store_service_ = &store_service_;
+    for (int64_t idx = 0; idx < TASK_COUNT; idx++) {
+      snprintf(data_[idx], sizeof(data_[idx]), "redo_data_%ld", idx);
+    }
+  }
+  virtual void TearDown()
+  {
+    storager_.inited_ = false;
+    storager_.store_service_ = NULL;
+  }
+
+  // Same key and value as ObLogStorager::handle_task_ uses for the task
+  void add_task(ObLogStorager::StoreWriteBatch &write_batch, const int64_t idx)
+  {
+    ObLogStoreTask *store_task = ObLogStoreTaskFactory::alloc();
+    std::string key;
+    const int64_t data_len = strlen(data_[idx]);
+    ASSERT_TRUE(NULL != store_task);
+    ASSERT_EQ(OB_SUCCESS, store_task->init(TenantLSID(TENANT_ID, share::ObLSID(LS_ID)),
+        palf::LSN(idx * 1024), data_[idx], data_len, &log_callback_));
+    ASSERT_EQ(OB_SUCCESS, store_task->get_store_key().get_key(key));
+    write_batch.keys_.push_back(key);
+    write_batch.values_.push_back(ObSlice(data_[idx], data_len));
+    write_batch.tasks_.push_back(store_task);
+    write_batch.data_size_ += data_len;
+  }
+
+public:
+  ObLogStorager storager_;
+  MockStoreService store_service_;
+  MockLogCallback log_callback_;
+  char data_[TASK_COUNT][32];
+};
+
+// Data written with one batch_write is the same as data written with one put per task
+TEST_F(TestLogStorager, flush_write_batch_same_as_put)
+{
+  ObLogStorager::StoreWriteBatch write_batch;
+  MockStoreService put_store_service;
+  const int64_t alloc_count = ObLogStoreTaskFactory::get_alloc_count();
+  const int64_t release_count = ObLogStoreTaskFactory::get_release_count();
+
+  for (int64_t idx = 0; idx < TASK_COUNT; idx++) {
+    add_task(write_batch, idx);
+    ASSERT_EQ(OB_SUCCESS, put_store_service.put(write_batch.keys_[idx], write_batch.values_[idx]));
+  }
+  EXPECT_FALSE(write_batch.is_empty());
+  EXPECT_FALSE(write_batch.is_full());
+
+  ASSERT_EQ(OB_SUCCESS, storager_.flush_write_batch_(write_batch, 0));
+  EXPECT_EQ(1, store_service_.batch_write_count_);
+  EXPECT_EQ(0, store_service_.put_count_);
+  EXPECT_EQ(TASK_COUNT, put_store_service.put_count_);
+  EXPECT_TRUE(put_store_service.kv_ == store_service_.kv_);
+
+  std::string value;
+  ASSERT_EQ(OB_SUCCESS, store_service_.get("1002_1001_2048", value));
+  EXPECT_EQ(std::string("redo_data_2"), value);
+
+  // All tasks are notified and released after the batch is persisted
+  EXPECT_EQ(TASK_COUNT, log_callback_.callback_count_);
+  EXPECT_TRUE(write_batch.is_empty());
+  EXPECT_EQ(0, write_batch.data_size_);
+  EXPECT_TRUE(NULL == write_batch.cf_handle_);
+  EXPECT_EQ(TASK_COUNT, ObLogStoreTaskFactory::get_alloc_count() - alloc_count);
+  EXPECT_EQ(TASK_COUNT, ObLogStoreTaskFactory::get_release_count() - release_count);
+}
+
+// Tasks are not notified if batch_write fails, fail_write_batch_ releases them
+TEST_F(TestLogStorager, fail_write_batch)
+{
+  ObLogStorager::StoreWriteBatch write_batch;
+  const int64_t release_count = ObLogStoreTaskFactory::get_release_count();
+
+  for (int64_t idx = 0; idx < TASK_COUNT; idx++) {
+    add_task(write_batch, idx);
+  }
+
+  store_service_.batch_write_ret_ = OB_IO_ERROR;
+  ASSERT_EQ(OB_IO_ERROR, storager_.flush_write_batch_(write_batch, 0));
+  EXPECT_EQ(0, log_callback_.callback_count_);
+  EXPECT_TRUE(store_service_.kv_.empty());
+  EXPECT_EQ(TASK_COUNT, static_cast<int64_t>(write_batch.tasks_.size()));
+  EXPECT_EQ(0, ObLogStoreTaskFactory::get_release_count() - release_count);
+
+  storager_.fail_write_batch_(write_batch, OB_IO_ERROR);
+  EXPECT_EQ(0, log_callback_.callback_count_);
+  EXPECT_TRUE(write_batch.is_empty());
+  EXPECT_EQ(0, write_batch.data_size_);
+  EXPECT_EQ(TASK_COUNT, ObLogStoreTaskFactory::get_release_count() - release_count);
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_ob_log_storager.log", true);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#define private public
+#include "observer/omt/ob_tenant.h"
+#undef private
+
+using namespace oceanbase::common;
+using namespace oceanbase::omt;
+
+class TestQueueTimeHistogram : public ::testing::Test
+{
+public:
+  // bucket of a single queue time added to an empty histogram
+  int64_t bucket_of(const int64_t queue_time_us)
+  {
+    int64_t bucket = -1;
+    int64_t cnt[ObQueueTimeHistogram::BUCKET_CNT];
+    hist_.reset();
+    hist_.add(queue_time_us);
+    EXPECT_EQ(1, hist_.sum_buckets(cnt));
+    for (int64_t i = 0; i < ObQueueTimeHistogram::BUCKET_CNT; i++) {
+      if (cnt[i] > 0) {
+        bucket = i;
+      }
+    }
+    return bucket;
+  }
+
+public:
+  ObQueueTimeHistogram hist_;
+};
+
+TEST_F(TestQueueTimeHistogram, bucket_index)
+{
+  EXPECT_EQ(0, bucket_of(-1));
+  EXPECT_EQ(0, bucket_of(0));
+  EXPECT_EQ(1, bucket_of(1));
+  // 2^k is the lower bound of bucket k + 1
+  for (int64_t k = 1; k < ObQueueTimeHistogram::BUCKET_CNT - 1; k++) {
+    EXPECT_EQ(k, bucket_of((1L << k) - 1));
+    EXPECT_EQ(k + 1, bucket_of(1L << k));
+  }
+  // too long queue time goes to the last bucket
+  EXPECT_EQ(ObQueueTimeHistogram::BUCKET_CNT - 1, bucket_of(1L << (ObQueueTimeHistogram::BUCKET_CNT - 1)));
+  EXPECT_EQ(ObQueueTimeHistogram::BUCKET_CNT - 1, bucket_of(1L << 40));
+  EXPECT_EQ(ObQueueTimeHistogram::BUCKET_CNT - 1, bucket_of(INT64_MAX));
+}
+
+TEST_F(TestQueueTimeHistogram, percentile)
+{
+  EXPECT_EQ(0, hist_.get_count());
+  EXPECT_EQ(0, hist_.get_percentile(0.5));
+
+  // all in one bucket
+  for (int64_t i = 0; i < 100; i++) {
+    hist_.add(10);
+  }
+  EXPECT_EQ(100, hist_.get_count());
+  EXPECT_EQ(16, hist_.get_percentile(0.5));
+  EXPECT_EQ(16, hist_.get_percentile(0.99));
+
+  // 50 in [2, 4), 49 in [64, 128), 1 in [4096, 8192)
+  hist_.reset();
+  for (int64_t i = 0; i < 50; i++) {
+    hist_.add(3);
+  }
+  for (int64_t i = 0; i < 49; i++) {
+    hist_.add(100);
+  }
+  hist_.add(5000);
+  EXPECT_EQ(100, hist_.get_count());
+  EXPECT_EQ(4, hist_.get_percentile(0.5));
+  EXPECT_EQ(128, hist_.get_percentile(0.51));
+  EXPECT_EQ(128, hist_.get_percentile(0.99));
+  EXPECT_EQ(8192, hist_.get_percentile(0.999));
+  EXPECT_EQ(8192, hist_.get_percentile(1.0));
+
+  // percentile of the last bucket
+  hist_.reset();
+  hist_.add(INT64_MAX);
+  EXPECT_EQ(1L << (ObQueueTimeHistogram::BUCKET_CNT - 1), hist_.get_percentile(0.99));
+}
+
+TEST_F(TestQueueTimeHistogram, sum_shards_and_reset)
+{
+  int64_t cnt[ObQueueTimeHistogram::BUCKET_CNT];
+  for (int64_t i = 0; i < ObQueueTimeHistogram::N_SHARD; i++) {
+    hist_.shards_[i].cnt_[3] = 1;
+    hist_.shards_[i].cnt_[5] = i;
+  }
+  EXPECT_EQ(ObQueueTimeHistogram::N_SHARD * (ObQueueTimeHistogram::N_SHARD + 1) / 2,
+            hist_.sum_buckets(cnt));
+  EXPECT_EQ(ObQueueTimeHistogram::N_SHARD, cnt[3]);
+  EXPECT_EQ(ObQueueTimeHistogram::N_SHARD * (ObQueueTimeHistogram::N_SHARD - 1) / 2, cnt[5]);
+  EXPECT_EQ(32, hist_.get_percentile(0.99));
+
+  hist_.reset();
+  EXPECT_EQ(0, hist_.sum_buckets(cnt));
+  for (int64_t i = 0; i < ObQueueTimeHistogram::N_SHARD; i++) {
+    for (int64_t j = 0; j < ObQueueTimeHistogram::BUCKET_CNT; j++) {
+      EXPECT_EQ(0, hist_.shards_[i].cnt_[j]);
+    }
+  }
+  EXPECT_EQ(0, hist_.get_count());
+  EXPECT_EQ(0, hist_.get_percentile(0.99));
+}
+
+TEST_F(TestQueueTimeHistogram, concurrent_add)
+{
+  const int64_t THREAD_CNT = 8;
+  const int64_t ADD_CNT = 100000;
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < THREAD_CNT; i++) {
+    threads.push_back(std::thread([this, i, ADD_CNT]() {
+      for (int64_t j = 0; j < ADD_CNT; j++) {
+        hist_.add(i + 1);
+      }
+    }));
+  }
+  for (int64_t i = 0; i < THREAD_CNT; i++) {
+    threads[i].join();
+  }
+  EXPECT_EQ(THREAD_CNT * ADD_CNT, hist_.get_count());
+  EXPECT_EQ(8, hist_.get_percentile(0.5));
+  EXPECT_EQ(16, hist_.get_percentile(0.99));
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_queue_time_histogram.log", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
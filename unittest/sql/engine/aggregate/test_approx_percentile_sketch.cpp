@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <algorithm>
+#include "sql/engine/aggregate/ob_approx_percentile_sketch.h"
+#include "share/ob_errno.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+class TestApproxPercentileSketch : public ::testing::Test
+{
+public:
+  TestApproxPercentileSketch() {}
+  virtual ~TestApproxPercentileSketch() {}
+
+  void init_sketch(std::vector<char> &buf, const int64_t compression)
+  {
+    buf.resize(ObApproxPercentileSketch::get_size(compression));
+    ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::init(&buf[0], buf.size(), compression));
+  }
+  // rank of %value in sorted %values
+  double rank_of(const std::vector<double> &values, const double value)
+  {
+    return static_cast<double>(std::lower_bound(values.begin(), values.end(), value)
+                               - values.begin()) / values.size();
+  }
+};
+
+TEST_F(TestApproxPercentileSketch, empty_and_small)
+{
+  std::vector<char> buf;
+  init_sketch(buf, ObApproxPercentileSketch::DEFAULT_COMPRESSION);
+  double result = 0;
+  bool is_null = false;
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::get_percentile(&buf[0], buf.size(), 0.5,
+                                                                 result, is_null));
+  ASSERT_TRUE(is_null);
+  for (int64_t i = 1; i <= 5; i++) {
+    ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::add(&buf[0], buf.size(), i));
+  }
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::get_percentile(&buf[0], buf.size(), 0.5,
+                                                                 result, is_null));
+  ASSERT_FALSE(is_null);
+  ASSERT_DOUBLE_EQ(3, result);
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::get_percentile(&buf[0], buf.size(), 0,
+                                                                 result, is_null));
+  ASSERT_DOUBLE_EQ(1, result);
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::get_percentile(&buf[0], buf.size(), 1,
+                                                                 result, is_null));
+  ASSERT_DOUBLE_EQ(5, result);
+  ASSERT_EQ(OB_ERR_PERCENTILE_VALUE_INVALID,
+            ObApproxPercentileSketch::get_percentile(&buf[0], buf.size(), 1.5, result, is_null));
+  ASSERT_EQ(OB_ERR_PERCENTILE_VALUE_INVALID,
+            ObApproxPercentileSketch::set_percentile(&buf[0], buf.size(), -0.1));
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::set_percentile(&buf[0], buf.size(), 0.5));
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::estimate(&buf[0], buf.size(), result, is_null));
+  ASSERT_DOUBLE_EQ(3, result);
+}
+
+TEST_F(TestApproxPercentileSketch, accuracy_and_merge)
+{
+  const int64_t N = 200000;
+  std::vector<char> left;
+  std::vector<char> right;
+  init_sketch(left, ObApproxPercentileSketch::DEFAULT_COMPRESSION);
+  init_sketch(right, ObApproxPercentileSketch::MIN_COMPRESSION * 5);
+  std::vector<double> values;
+  std::vector<double> batch;
+  srandom(0);
+  for (int64_t i = 0; i < N; i++) {
+    const double v = static_cast<double>(random() % 1000000) / 7;
+    values.push_back(v);
+    if (i % 2 == 0) {
+      ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::add(&left[0], left.size(), v));
+    } else {
+      batch.push_back(v);
+    }
+  }
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::add_batch(&right[0], right.size(),
+                                                            &batch[0], batch.size()));
+  ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::merge(&left[0], left.size(),
+                                                        &right[0], right.size()));
+  std::sort(values.begin(), values.end());
+  const double percentiles[] = {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99};
+  for (int64_t i = 0; i < ARRAYSIZEOF(percentiles); i++) {
+    double result = 0;
+    bool is_null = true;
+    ASSERT_EQ(OB_SUCCESS, ObApproxPercentileSketch::get_percentile(&left[0], left.size(),
+                                                                   percentiles[i],
+                                                                   result, is_null));
+    ASSERT_FALSE(is_null);
+    ASSERT_NEAR(percentiles[i], rank_of(values, result), 0.01);
+  }
+  // merge of invalid sketch
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObApproxPercentileSketch::merge(&left[0], left.size(),
+                                                                 &right[0], 16));
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
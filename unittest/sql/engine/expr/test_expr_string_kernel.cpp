@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "sql/engine/expr/ob_expr_string_kernel.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+class TestExprStringKernel : public ::testing::Test
+{
+public:
+  TestExprStringKernel() {}
+  virtual ~TestExprStringKernel() {}
+
+  static std::string random_str(const int64_t len, const char *alphabet)
+  {
+    std::string str;
+    const int64_t n = strlen(alphabet);
+    for (int64_t i = 0; i < len; i++) {
+      str.push_back(alphabet[random() % n]);
+    }
+    return str;
+  }
+  static const char *find_ci_ref(const std::string &text, const std::string &pat)
+  {
+    const char *res = NULL;
+    for (int64_t i = 0; NULL == res && i + pat.length() <= text.length(); i++) {
+      bool equal = true;
+      for (int64_t j = 0; equal && j < pat.length(); j++) {
+        equal = tolower(text[i + j]) == tolower(pat[j]);
+      }
+      res = equal ? text.data() + i : NULL;
+    }
+    return res;
+  }
+};
+
+TEST_F(TestExprStringKernel, find)
+{
+  srandom(0);
+  // short alphabet with non-ASCII byte to get many partial matches
+  const char *alphabet = "abAB c\xc3";
+  for (int64_t i = 0; i < 100000; i++) {
+    const std::string text = random_str(random() % 100, alphabet);
+    const std::string pat = random_str(random() % 6, alphabet);
+    ASSERT_EQ(memmem(text.data(), text.length(), pat.data(), pat.length()),
+              ObExprStringKernel::find(text.data(), text.length(), pat.data(), pat.length()));
+  }
+}
+
+TEST_F(TestExprStringKernel, find_ascii_ci)
+{
+  srandom(0);
+  const char *alphabet = "abAB c[{@`";
+  for (int64_t i = 0; i < 100000; i++) {
+    const std::string text = random_str(random() % 100, alphabet);
+    const std::string pat = random_str(random() % 6, alphabet);
+    ASSERT_EQ(find_ci_ref(text, pat),
+              ObExprStringKernel::find_ascii_ci(text.data(), text.length(),
+                                                pat.data(), pat.length()));
+  }
+}
+
+TEST_F(TestExprStringKernel, ascii_and_case)
+{
+  srandom(0);
+  const char *alphabet = "azAZ@[`{09 ~\x7f";
+  for (int64_t i = 0; i < 10000; i++) {
+    std::string str = random_str(random() % 100, alphabet);
+    std::string lower(str.length(), 0);
+    std::string upper(str.length(), 0);
+    ObExprStringKernel::ascii_tolower(str.data(), str.length(), &lower[0]);
+    ObExprStringKernel::ascii_toupper(str.data(), str.length(), &upper[0]);
+    for (int64_t j = 0; j < str.length(); j++) {
+      ASSERT_EQ(tolower(str[j]), lower[j]);
+      ASSERT_EQ(toupper(str[j]), upper[j]);
+    }
+    ASSERT_TRUE(ObExprStringKernel::is_ascii(str.data(), str.length()));
+    if (!str.empty()) {
+      str[random() % str.length()] = '\x80';
+      ASSERT_FALSE(ObExprStringKernel::is_ascii(str.data(), str.length()));
+    }
+  }
+}
+
+TEST_F(TestExprStringKernel, locate)
+{
+  srandom(0);
+  const ObCollationType cs_types[] = { CS_TYPE_BINARY, CS_TYPE_UTF8MB4_BIN,
+                                       CS_TYPE_UTF8MB4_GENERAL_CI };
+  // 'é' is equal to 'e' in utf8mb4_general_ci
+  const char *chars[] = { "a", "A", "e", "E", " ", "\xc3\xa9" };
+  for (int64_t i = 0; i < 20000; i++) {
+    const ObCollationType cs_type = cs_types[i % ARRAYSIZEOF(cs_types)];
+    // ASCII only or with non-ASCII chars
+    const int64_t char_cnt = 0 == random() % 2 ? ARRAYSIZEOF(chars) - 1 : ARRAYSIZEOF(chars);
+    std::string text;
+    std::string pat;
+    for (int64_t len = random() % 60; len > 0; len--) {
+      text.append(chars[random() % char_cnt]);
+    }
+    for (int64_t len = random() % 4; len > 0; len--) {
+      pat.append(chars[random() % char_cnt]);
+    }
+    const int64_t pos = random() % 70 - 2;
+    ASSERT_EQ(ObCharset::locate(cs_type, text.data(), text.length(),
+                                pat.data(), pat.length(), pos),
+              ObExprStringKernel::locate(cs_type, text.data(), text.length(),
+                                         pat.data(), pat.length(), pos));
+  }
+}
+
+// Benchmark of the kernels against the scalar versions, e.g.
+//   ./test_expr_string_kernel --gtest_also_run_disabled_tests --gtest_filter=*benchmark*
+TEST_F(TestExprStringKernel, DISABLED_benchmark)
+{
+  srandom(0);
+  const int64_t TEXT_LEN = 256;
+  const int64_t TEXT_CNT = 4096;
+  const int64_t ROUNDS = 100;
+  std::vector<std::string> texts;
+  for (int64_t i = 0; i < TEXT_CNT; i++) {
+    texts.push_back(random_str(TEXT_LEN, "abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+  }
+  const std::string pat = "Needle";
+  int64_t found = 0;
+  int64_t begin = ObTimeUtility::current_time();
+  for (int64_t r = 0; r < ROUNDS; r++) {
+    for (int64_t i = 0; i < TEXT_CNT; i++) {
+      found += NULL != memmem(texts[i].data(), TEXT_LEN, pat.data(), pat.length());
+    }
+  }
+  const int64_t memmem_us = ObTimeUtility::current_time() - begin;
+  begin = ObTimeUtility::current_time();
+  for (int64_t r = 0; r < ROUNDS; r++) {
+    for (int64_t i = 0; i < TEXT_CNT; i++) {
+      found += NULL != ObExprStringKernel::find(texts[i].data(), TEXT_LEN,
+                                                pat.data(), pat.length());
+    }
+  }
+  const int64_t find_us = ObTimeUtility::current_time() - begin;
+  begin = ObTimeUtility::current_time();
+  for (int64_t r = 0; r < ROUNDS; r++) {
+    for (int64_t i = 0; i < TEXT_CNT; i++) {
+      found += ObCharset::locate(CS_TYPE_UTF8MB4_GENERAL_CI, texts[i].data(), TEXT_LEN,
+                                 pat.data(), pat.length(), 1);
+    }
+  }
+  const int64_t charset_ci_us = ObTimeUtility::current_time() - begin;
+  begin = ObTimeUtility::current_time();
+  for (int64_t r = 0; r < ROUNDS; r++) {
+    for (int64_t i = 0; i < TEXT_CNT; i++) {
+      found += ObExprStringKernel::locate(CS_TYPE_UTF8MB4_GENERAL_CI, texts[i].data(), TEXT_LEN,
+                                          pat.data(), pat.length(), 1);
+    }
+  }
+  const int64_t kernel_ci_us = ObTimeUtility::current_time() - begin;
+  std::string buf(TEXT_LEN, 0);
+  begin = ObTimeUtility::current_time();
+  for (int64_t r = 0; r < ROUNDS; r++) {
+    for (int64_t i = 0; i < TEXT_CNT; i++) {
+      ObCharset::casedn(CS_TYPE_UTF8MB4_GENERAL_CI, const_cast<char *>(texts[i].data()),
+                        TEXT_LEN, &buf[0], TEXT_LEN);
+    }
+  }
+  const int64_t charset_lower_us = ObTimeUtility::current_time() - begin;
+  begin = ObTimeUtility::current_time();
+  for (int64_t r = 0; r < ROUNDS; r++) {
+    for (int64_t i = 0; i < TEXT_CNT; i++) {
+      if (ObExprStringKernel::is_ascii(texts[i].data(), TEXT_LEN)) {
+        ObExprStringKernel::ascii_tolower(texts[i].data(), TEXT_LEN, &buf[0]);
+      }
+    }
+  }
+  const int64_t kernel_lower_us = ObTimeUtility::current_time() - begin;
+  std::cout << "found: " << found << std::endl
+            << "memmem: " << memmem_us << "us, find: " << find_us << "us" << std::endl
+            << "locate general_ci: " << charset_ci_us << "us, kernel: " << kernel_ci_us << "us"
+            << std::endl
+            << "lower general_ci: " << charset_lower_us << "us, kernel: " << kernel_lower_us
+            << "us" << std::endl;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+#define private public
+#define protected public
+
+#include "storage/memtable/ob_lock_wait_mgr.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace oceanbase::common;
+using namespace oceanbase::memtable;
+
+// row hash has the two highest bits cleared, trans hash has the highest bit set
+static const uint64_t ROW_HASH = (0x1234567890ab1L << 2) | 1;
+static const uint64_t TX_HASH = (1UL << 63) | 0x5678901 | 1;
+static const int64_t HOLDER_TX_ID = 1000;
+
+class ObMockLockWaitMgr : public ObLockWaitMgr
+{
+public:
+  virtual int repost(Node *node) override
+  {
+    return reposted_.push_back(node);
+  }
+  virtual void change_detector_to_row(Node *node, const uint64_t row_hash) override
+  {
+    blocked_on_row_.push_back(std::make_pair(node->tx_id_, row_hash));
+  }
+  ObSEArray<Node *, 8> reposted_;
+  std::vector<std::pair<int64_t, uint64_t>> blocked_on_row_;
+};
+
+class TestLockWaitMgr : public ::testing::Test
+{
+public:
+  virtual void SetUp() override
+  {
+    mgr_.stop_ = false;
+    mgr_.enable_handoff_ = true;
+    ObLockWaitMgr::clear_thread_node();
+  }
+  virtual void TearDown() override
+  {
+    ObLockWaitMgr::Node *node = NULL;
+    while (NULL != (node = mgr_.fetch_waiter(ROW_HASH)));
+    while (NULL != (node = mgr_.fetch_waiter(TX_HASH)));
+    ObLockWaitMgr::clear_thread_node();
+    mgr_.stop_ = true;
+  }
+  // park the request on the row it conflicts on, and then transfer it to the
+  // holder transaction as transform_row_lock_to_tx_lock does
+  void park(ObLockWaitNode &node, const uint64_t origin_hash, const int64_t recv_ts, const int64_t tx_id)
+  {
+    node.set(&node, origin_hash, mgr_.get_seq(origin_hash), INT64_MAX, 1, 0, 0, "row", tx_id, HOLDER_TX_ID);
+    node.recv_ts_ = recv_ts;
+    if (origin_hash != TX_HASH) {
+      node.change_hash(TX_HASH, mgr_.get_seq(TX_HASH));
+    }
+    ASSERT_TRUE(mgr_.wait(&node));
+  }
+  // the woken request is running in the worker thread
+  void run(ObLockWaitNode &node, const bool lock_row, const bool need_retry)
+  {
+    bool need_wait = false;
+    mgr_.setup(node, node.recv_ts_);
+    if (lock_row) {
+      ObLockWaitMgr::get_thread_handoff_locked() = true;
+    }
+    mgr_.post_process(need_retry, need_wait);
+    ObLockWaitMgr::clear_thread_node();
+  }
+
+  ObMockLockWaitMgr mgr_;
+};
+
+TEST_F(TestLockWaitMgr, handoff_one_waiter_per_row)
+{
+  ObLockWaitNode n1, n2, n3, n4;
+  park(n1, ROW_HASH, 1, 1);
+  park(n2, ROW_HASH, 2, 2);
+  park(n3, ROW_HASH, 3, 3);
+  park(n4, TX_HASH, 4, 4);
+
+  // the holder commits
+  mgr_.wakeup(TX_HASH);
+
+  // only the first waiter of the row and the waiter of the trans are woken
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  EXPECT_EQ(&n1, mgr_.reposted_.at(0));
+  EXPECT_EQ(ROW_HASH, n1.hold_key_);
+  EXPECT_TRUE(n1.is_handoff_);
+  EXPECT_EQ(&n4, mgr_.reposted_.at(1));
+  EXPECT_EQ(TX_HASH, n4.hold_key_);
+  EXPECT_FALSE(n4.is_handoff_);
+
+  // the others are parked back on the row without counting a new try
+  EXPECT_EQ(ROW_HASH, n2.hash());
+  EXPECT_EQ(ROW_HASH, n3.hash());
+  EXPECT_EQ(1, n2.try_lock_times_);
+  EXPECT_EQ(1, n3.try_lock_times_);
+  EXPECT_EQ(&n2, mgr_.fetch_waiter(ROW_HASH));
+  EXPECT_EQ(&n3, mgr_.fetch_waiter(ROW_HASH));
+  EXPECT_EQ(nullptr, mgr_.fetch_waiter(ROW_HASH));
+}
+
+TEST_F(TestLockWaitMgr, deadlock_detector_follows_row_after_handoff)
+{
+  ObLockWaitNode n1, n2, n3, n4;
+  park(n1, ROW_HASH, 1, 1);
+  park(n2, ROW_HASH, 2, 2);
+  park(n3, ROW_HASH, 3, 3);
+  park(n4, TX_HASH, 4, 4);
+
+  mgr_.wakeup(TX_HASH);
+
+  // waiters parked back on the row block on the row holder again, the woken
+  // ones unregister when they are reposted
+  ASSERT_EQ(2U, mgr_.blocked_on_row_.size());
+  EXPECT_EQ(2, mgr_.blocked_on_row_[0].first);
+  EXPECT_EQ(ROW_HASH, mgr_.blocked_on_row_[0].second);
+  EXPECT_EQ(3, mgr_.blocked_on_row_[1].first);
+  EXPECT_EQ(ROW_HASH, mgr_.blocked_on_row_[1].second);
+}
+
+TEST_F(TestLockWaitMgr, wakeup_next_waiter_at_holder_commit)
+{
+  ObLockWaitNode n1, n2, n3;
+  park(n1, ROW_HASH, 1, 1);
+  park(n2, ROW_HASH, 2, 2);
+  park(n3, ROW_HASH, 3, 3);
+
+  mgr_.wakeup(TX_HASH);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+
+  // n1 locks the row, neither its statement end nor the post process in
+  // request_finish_callback wakes up the row
+  bool need_wait = false;
+  mgr_.setup(n1, n1.recv_ts_);
+  ObLockWaitMgr::get_thread_handoff_locked() = true;
+  mgr_.post_process(false, need_wait);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  mgr_.post_process(false, need_wait);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  ObLockWaitMgr::clear_thread_node();
+
+  // n1 commits, and the row is handed to the waiters one by one in FIFO order
+  mgr_.wakeup(ROW_HASH);
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  EXPECT_EQ(&n2, mgr_.reposted_.at(1));
+  EXPECT_EQ(ROW_HASH, n2.hold_key_);
+  EXPECT_TRUE(n2.is_handoff_);
+  // n2 locks the row, n3 keeps waiting until n2 commits
+  run(n2, true /*lock_row*/, false /*need_retry*/);
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  mgr_.wakeup(ROW_HASH);
+  ASSERT_EQ(3, mgr_.reposted_.count());
+  EXPECT_EQ(&n3, mgr_.reposted_.at(2));
+  EXPECT_TRUE(n3.is_handoff_);
+  EXPECT_EQ(nullptr, mgr_.fetch_waiter(ROW_HASH));
+}
+
+TEST_F(TestLockWaitMgr, wakeup_next_waiter_at_row_commit_if_not_locked)
+{
+  ObLockWaitNode n1, n2, n3;
+  park(n1, ROW_HASH, 1, 1);
+  park(n2, ROW_HASH, 2, 2);
+  park(n3, ROW_HASH, 3, 3);
+  mgr_.wakeup(TX_HASH);
+  run(n1, true /*lock_row*/, false /*need_retry*/);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+
+  // n1 commits and n2 is handed the row, n2 finishes without locking it, so
+  // the next waiter is woken at once
+  mgr_.wakeup(ROW_HASH);
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  EXPECT_TRUE(n2.is_handoff_);
+  run(n2, false /*lock_row*/, false /*need_retry*/);
+  ASSERT_EQ(3, mgr_.reposted_.count());
+  EXPECT_EQ(&n3, mgr_.reposted_.at(2));
+}
+
+TEST_F(TestLockWaitMgr, wakeup_next_waiter_if_row_not_locked)
+{
+  ObLockWaitNode n1, n2, n3;
+  park(n1, ROW_HASH, 1, 1);
+  park(n2, ROW_HASH, 2, 2);
+  park(n3, ROW_HASH, 3, 3);
+
+  mgr_.wakeup(TX_HASH);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+
+  // n1 retries, the row is handed to the next waiter
+  run(n1, false /*lock_row*/, true /*need_retry*/);
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  EXPECT_EQ(&n2, mgr_.reposted_.at(1));
+
+  // n2 finishes without locking the row, the next waiter is woken at once
+  run(n2, false /*lock_row*/, false /*need_retry*/);
+  ASSERT_EQ(3, mgr_.reposted_.count());
+  EXPECT_EQ(&n3, mgr_.reposted_.at(2));
+}
+
+TEST_F(TestLockWaitMgr, no_handoff_wakes_all)
+{
+  ObLockWaitNode n1, n2, n3;
+  mgr_.enable_handoff_ = false;
+  park(n1, ROW_HASH, 1, 1);
+  park(n2, ROW_HASH, 2, 2);
+  park(n3, ROW_HASH, 3, 3);
+
+  mgr_.wakeup(TX_HASH);
+  ASSERT_EQ(3, mgr_.reposted_.count());
+  EXPECT_EQ(0U, mgr_.blocked_on_row_.size());
+  EXPECT_FALSE(n1.is_handoff_);
+}
+
+TEST_F(TestLockWaitMgr, no_handoff_row_wakeup_retries)
+{
+  ObLockWaitNode n1, n2;
+  mgr_.enable_handoff_ = false;
+  n1.set(&n1, ROW_HASH, mgr_.get_seq(ROW_HASH), INT64_MAX, 1, 0, 0, "row", 1, HOLDER_TX_ID);
+  ASSERT_TRUE(mgr_.wait(&n1));
+  n2.set(&n2, ROW_HASH, mgr_.get_seq(ROW_HASH), INT64_MAX, 1, 0, 0, "row", 2, HOLDER_TX_ID);
+  ASSERT_TRUE(mgr_.wait(&n2));
+
+  mgr_.wakeup(ROW_HASH);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  EXPECT_EQ(&n1, mgr_.reposted_.at(0));
+  EXPECT_EQ(ROW_HASH, n1.hold_key_);
+  EXPECT_FALSE(n1.is_handoff_);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_lock_wait_mgr.log*");
+  oceanbase::common::ObLogger::get_logger().set_file_name("test_lock_wait_mgr.log", true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
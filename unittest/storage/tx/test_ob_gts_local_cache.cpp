@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "storage/tx/ob_gts_local_cache.h"
+#undef private
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+namespace unittest
+{
+
+class TestObGtsLocalCache : public ::testing::Test
+{
+public :
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_F(TestObGtsLocalCache, batch_requests_on_inflight_rpc)
+{
+  ObGTSLocalCache cache;
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  bool need_send_rpc = false;
+  bool is_batched = false;
+  bool update = false;
+  const MonotonicTs srr1 = MonotonicTs::current_time();
+  // the first request sends the rpc
+  ASSERT_EQ(OB_EAGAIN, cache.get_gts(srr1, gts, receive_gts_ts, need_send_rpc, is_batched));
+  ASSERT_TRUE(need_send_rpc);
+  ASSERT_FALSE(is_batched);
+  ASSERT_EQ(OB_SUCCESS, cache.update_latest_srr(srr1));
+  ASSERT_TRUE(cache.is_rpc_inflight(srr1));
+  ASSERT_EQ(OB_SUCCESS, cache.update_gts(srr1, 100, srr1 + MonotonicTs(1000), update));
+  ASSERT_TRUE(update);
+  ASSERT_FALSE(cache.is_rpc_inflight(MonotonicTs::current_time()));
+  ASSERT_EQ(1000, cache.get_rpc_rt());
+
+  // a request arriving while the next rpc is on the way joins it
+  const MonotonicTs srr2 = srr1 + MonotonicTs(10);
+  ASSERT_EQ(OB_SUCCESS, cache.update_latest_srr(srr2));
+  ASSERT_TRUE(cache.is_rpc_inflight(srr2 + MonotonicTs(1000)));
+
+  // the batching window is bounded, a lost rpc does not stall the waiters
+  ASSERT_FALSE(cache.is_rpc_inflight(srr2 + MonotonicTs(ObGTSLocalCache::MAX_BATCH_WINDOW_US)));
+
+  // the requests served by the cache
+  ASSERT_EQ(OB_SUCCESS, cache.get_gts(srr1, gts, receive_gts_ts, need_send_rpc, is_batched));
+  ASSERT_EQ(100, gts);
+  ASSERT_FALSE(need_send_rpc);
+  ASSERT_FALSE(is_batched);
+}
+
+TEST_F(TestObGtsLocalCache, count_only_requests_joining_inflight_rpc)
+{
+  ObGTSLocalCache cache;
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  bool need_send_rpc = false;
+  bool is_batched = false;
+  bool update = false;
+  const MonotonicTs srr1 = MonotonicTs::current_time();
+  ASSERT_EQ(OB_SUCCESS, cache.update_gts(srr1, 100, srr1 + MonotonicTs(1000), update));
+
+  // the rpc is just sent
+  const MonotonicTs srr2 = MonotonicTs::current_time();
+  ASSERT_EQ(OB_SUCCESS, cache.update_latest_srr(srr2));
+
+  // the request covered by the sent rpc is not batched
+  ASSERT_EQ(OB_EAGAIN, cache.get_gts(srr2, gts, receive_gts_ts, need_send_rpc, is_batched));
+  ASSERT_FALSE(need_send_rpc);
+  ASSERT_FALSE(is_batched);
+
+  // the request later than the sent rpc joins it
+  ASSERT_EQ(OB_EAGAIN, cache.get_gts(srr2 + MonotonicTs(1), gts, receive_gts_ts, need_send_rpc, is_batched));
+  ASSERT_FALSE(need_send_rpc);
+  ASSERT_TRUE(is_batched);
+
+  // the request served by the cache is not batched
+  ASSERT_EQ(OB_SUCCESS, cache.get_gts(srr1, gts, receive_gts_ts, need_send_rpc, is_batched));
+  ASSERT_FALSE(need_send_rpc);
+  ASSERT_FALSE(is_batched);
+}
+
+TEST_F(TestObGtsLocalCache, batch_window_bounded_when_rtt_exceeds_cap)
+{
+  ObGTSLocalCache cache;
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  bool need_send_rpc = false;
+  bool is_batched = false;
+  bool update = false;
+  const int64_t rtt = 4 * ObGTSLocalCache::MAX_BATCH_WINDOW_US;
+  const MonotonicTs srr1 = MonotonicTs::current_time() - MonotonicTs(2 * rtt);
+  ASSERT_EQ(OB_SUCCESS, cache.update_gts(srr1, 100, srr1 + MonotonicTs(rtt), update));
+  ASSERT_EQ(rtt, cache.get_rpc_rt());
+
+  // the window is capped although twice the rtt is much larger
+  const MonotonicTs srr2 = srr1 + MonotonicTs(rtt);
+  ASSERT_EQ(OB_SUCCESS, cache.update_latest_srr(srr2));
+  ASSERT_TRUE(cache.is_rpc_inflight(srr2 + MonotonicTs(ObGTSLocalCache::MAX_BATCH_WINDOW_US - 1)));
+  ASSERT_FALSE(cache.is_rpc_inflight(srr2 + MonotonicTs(ObGTSLocalCache::MAX_BATCH_WINDOW_US)));
+  ASSERT_FALSE(cache.is_rpc_inflight(srr2 + MonotonicTs(2 * rtt - 1)));
+
+  // the rpc has been outstanding longer than the cap, a new request sends its
+  // own rpc instead of waiting for the slow one
+  ASSERT_EQ(OB_EAGAIN, cache.get_gts(MonotonicTs::current_time(), gts, receive_gts_ts, need_send_rpc, is_batched));
+  ASSERT_TRUE(need_send_rpc);
+  ASSERT_FALSE(is_batched);
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_local_cache.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}